@@ -156,6 +156,15 @@ extern "C"
         return globalCapi->SilKit_CanController_RemoveErrorStateChangeHandler(controller, handlerId);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_CanController_AddAcceptanceFilter(SilKit_CanController* controller,
+                                                                                     uint32_t canId, uint32_t mask,
+                                                                                     SilKit_CanFrameFlag flags,
+                                                                                     SilKit_CanFrameFlag flagsMask)
+    {
+        return globalCapi->SilKit_Experimental_CanController_AddAcceptanceFilter(controller, canId, mask, flags,
+                                                                                 flagsMask);
+    }
+
     // EthernetController
 
     SilKit_ReturnCode SilKitCALL SilKit_EthernetController_Create(SilKit_EthernetController** outController,
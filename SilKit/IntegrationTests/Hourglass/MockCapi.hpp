@@ -92,6 +92,10 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_CanController_RemoveErrorStateChangeHandler,
                 (SilKit_CanController * controller, SilKit_HandlerId handlerId));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_CanController_AddAcceptanceFilter,
+                (SilKit_CanController * controller, uint32_t canId, uint32_t mask, SilKit_CanFrameFlag flags,
+                 SilKit_CanFrameFlag flagsMask));
+
     // EthernetController
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_EthernetController_Create,
@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/capi/SilKit.h"
 
 #include "silkit/SilKit.hpp"
+#include "silkit/experimental/services/can/CanControllerExtensions.hpp"
 #include "silkit/detail/impl/ThrowOnError.hpp"
 
 #include "MockCapiTest.hpp"
@@ -268,4 +269,17 @@ TEST_F(Test_HourglassCan, SilKit_CanController_RemoveErrorStateChangeHandler)
     EXPECT_CALL(capi, SilKit_CanController_RemoveErrorStateChangeHandler(mockCanController, 1234)).Times(1);
     canController.RemoveErrorStateChangeHandler(handlerId);
 }
+
+TEST_F(Test_HourglassCan, SilKit_Experimental_CanController_AddAcceptanceFilter)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Can::CanController canController(
+        nullptr, "CanController1", "CanNetwork1");
+
+    EXPECT_CALL(capi, SilKit_Experimental_CanController_AddAcceptanceFilter(mockCanController, 0x100, 0x7F0,
+                                                                            SilKit_CanFrameFlag_ide,
+                                                                            SilKit_CanFrameFlag_ide))
+        .Times(1);
+    SilKit::Experimental::Services::Can::AddAcceptanceFilter(&canController, 0x100, 0x7F0, SilKit_CanFrameFlag_ide,
+                                                             SilKit_CanFrameFlag_ide);
+}
 } //namespace
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "silkit/services/pubsub/all.hpp"
+#include "silkit/vendor/CreateSilKitRegistry.hpp"
+
+#include "GetTestPid.hpp"
+#include "ConfigurationTestUtils.hpp"
+#include "CreateParticipantImpl.hpp"
+#include "IParticipantInternal.hpp"
+#include "DataSubscriberInternal.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Core;
+using namespace SilKit::Services::PubSub;
+
+// The internal subscriber of a data subscriber receives the data of a publisher through the publisher's link. Once the
+// link is removed again, the publishing participant must stop sending the data to it.
+TEST(ITest_Internals_DataSubscriberLinks, no_data_is_received_after_the_publisher_link_was_removed)
+{
+    auto registryUri = MakeTestRegistryUri();
+    const PubSubSpec dataSpec{"Topic", {}};
+
+    auto registry = SilKit::Vendor::Vector::CreateSilKitRegistry(SilKit::Config::MakeEmptyParticipantConfiguration());
+    registry->StartListening(registryUri);
+
+    auto&& publisher =
+        SilKit::CreateParticipantImpl(SilKit::Config::MakeEmptyParticipantConfigurationImpl(), "Publisher", registryUri);
+    auto&& subscriber =
+        SilKit::CreateParticipantImpl(SilKit::Config::MakeEmptyParticipantConfigurationImpl(), "Subscriber", registryUri);
+
+    auto* dataPublisher = publisher->CreateDataPublisher("PubCtrl", dataSpec, 0);
+    const auto publisherLinkName =
+        dynamic_cast<IServiceEndpoint&>(*dataPublisher).GetServiceDescriptor().GetNetworkName();
+
+    // The regular data subscriber keeps receiving the data, it tells when the publisher is still publishing
+    std::atomic<size_t> numWitnessReceived{0};
+    auto* dataSubscriber = subscriber->CreateDataSubscriber(
+        "SubCtrl", dataSpec, [&numWitnessReceived](IDataSubscriber*, const DataMessageEvent&) {
+            ++numWitnessReceived;
+        });
+
+    std::atomic<size_t> numReceived{0};
+    std::promise<void> receivedPromise;
+    auto& subscriberInternal = dynamic_cast<IParticipantInternal&>(*subscriber);
+    auto* internalSubscriber = subscriberInternal.CreateDataSubscriberInternal(
+        dataSpec.Topic(), "Subscriber/ReceiveLink", dataSpec.MediaType(), {},
+        [&numReceived, &receivedPromise](IDataSubscriber*, const DataMessageEvent&) {
+            if (++numReceived == 1)
+            {
+                receivedPromise.set_value();
+            }
+        },
+        dataSubscriber);
+    subscriberInternal.AddDataSubscriberInternalLink(internalSubscriber, publisherLinkName);
+
+    std::atomic<bool> stopPublishing{false};
+    std::thread publishThread{[dataPublisher, &stopPublishing] {
+        uint8_t counter = 0;
+        while (!stopPublishing)
+        {
+            dataPublisher->Publish(std::vector<uint8_t>{counter++});
+            std::this_thread::sleep_for(1ms);
+        }
+    }};
+
+    ASSERT_EQ(receivedPromise.get_future().wait_for(10s), std::future_status::ready);
+
+    subscriberInternal.RemoveDataSubscriberInternalLink(internalSubscriber, publisherLinkName);
+
+    // Give the removal time to reach the publishing participant, afterwards only the regular subscriber receives data
+    std::this_thread::sleep_for(500ms);
+    const auto numReceivedAfterRemoval = numReceived.load();
+    const auto numWitnessReceivedAfterRemoval = numWitnessReceived.load();
+
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (numWitnessReceived < numWitnessReceivedAfterRemoval + 100 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+
+    stopPublishing = true;
+    publishThread.join();
+
+    EXPECT_GE(numWitnessReceived, numWitnessReceivedAfterRemoval + 100);
+    EXPECT_EQ(numReceived, numReceivedAfterRemoval);
+}
+
+} // anonymous namespace
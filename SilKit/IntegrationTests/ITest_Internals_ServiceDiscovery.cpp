@@ -195,7 +195,7 @@ TEST_F(ITest_Internals_ServiceDiscovery, discover_specific_services)
     // Participants are already there, so the registration will trigger the provided handler immediately
     subscriberServiceDiscovery->RegisterSpecificServiceDiscoveryHandler(
         [numberOfServices, &allRemoved, &allCreated, &createdServiceNames, &removedServiceNames, publisherName](
-            auto discoveryType, const auto& service) {
+            auto discoveryType, const auto& service, const auto& /*labels*/) {
             switch (discoveryType)
             {
             case SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::Invalid: break;
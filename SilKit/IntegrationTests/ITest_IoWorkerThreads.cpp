@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "silkit/services/pubsub/all.hpp"
+#include "silkit/util/serdes/Serialization.hpp"
+
+#include "SimTestHarness.hpp"
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+using namespace std::chrono_literals;
+using namespace SilKit::Tests;
+using namespace SilKit::Services::PubSub;
+
+
+const std::string ioWorkerThreadsConfig = R"(
+Middleware:
+  IoWorkerThreads: 3
+)";
+
+constexpr std::chrono::nanoseconds stepSize{1ms};
+constexpr uint64_t numberOfSteps{100};
+
+
+auto SerializeStep(uint64_t step) -> std::vector<uint8_t>
+{
+    SilKit::Util::SerDes::Serializer serializer;
+    serializer.Serialize(step, 64);
+    return serializer.ReleaseBuffer();
+}
+
+auto DeserializeStep(const SilKit::Util::Span<const uint8_t>& data) -> uint64_t
+{
+    SilKit::Util::SerDes::Deserializer deserializer{SilKit::Util::ToStdVector(data)};
+    return deserializer.Deserialize<uint64_t>(64);
+}
+
+
+// User data is delivered by the additional IO workers, while the orchestration, lifecycle and discovery messages stay
+// on the IO thread. The whole lifecycle must still complete, and the data of a simulation step must be delivered before
+// the next simulation step of the subscriber, which is triggered by a system message sent after the data.
+TEST(ITest_IoWorkerThreads, lifecycle_and_data_ordering_with_multiple_io_workers)
+{
+    SimTestHarnessArgs args;
+    args.syncParticipantNames = {"Publisher", "Subscriber"};
+    args.deferParticipantCreation = true;
+
+    SimTestHarness testHarness{args};
+
+    auto* publisherParticipant = testHarness.GetParticipant("Publisher", ioWorkerThreadsConfig);
+    auto* subscriberParticipant = testHarness.GetParticipant("Subscriber", ioWorkerThreadsConfig);
+
+    PubSubSpec spec{"IoWorkerThreads", {}};
+
+    std::atomic<uint64_t> numberOfReceivedMessages{0};
+    std::atomic<bool> receivedOutOfOrder{false};
+    std::atomic<bool> receivedLate{false};
+
+    subscriberParticipant->Participant()->CreateDataSubscriber(
+        "Subscriber", spec, [&](IDataSubscriber*, const DataMessageEvent& event) {
+            if (DeserializeStep(event.data) != numberOfReceivedMessages)
+            {
+                receivedOutOfOrder = true;
+            }
+            ++numberOfReceivedMessages;
+        });
+
+    subscriberParticipant->GetOrCreateTimeSyncService()->SetSimulationStepHandler(
+        [&](std::chrono::nanoseconds now, std::chrono::nanoseconds) {
+            // the publisher sent one message in each of its steps before now
+            if (numberOfReceivedMessages < static_cast<uint64_t>(now / stepSize))
+            {
+                receivedLate = true;
+            }
+        },
+        stepSize);
+
+    auto* publisher = publisherParticipant->Participant()->CreateDataPublisher("Publisher", spec);
+    auto* lifecycleService = publisherParticipant->GetOrCreateLifecycleService();
+
+    publisherParticipant->GetOrCreateTimeSyncService()->SetSimulationStepHandler(
+        [&](std::chrono::nanoseconds now, std::chrono::nanoseconds) {
+            const auto step = static_cast<uint64_t>(now / stepSize);
+            if (step == numberOfSteps)
+            {
+                lifecycleService->Stop("Test done");
+                return;
+            }
+            publisher->Publish(SerializeStep(step));
+        },
+        stepSize);
+
+    ASSERT_TRUE(testHarness.Run(30s)) << "TestSim Harness should not reach timeout";
+
+    EXPECT_EQ(numberOfReceivedMessages, numberOfSteps);
+    EXPECT_FALSE(receivedOutOfOrder);
+    EXPECT_FALSE(receivedLate);
+}
+
+// The data of two publishing participants on the same network is delivered by the same worker, and neither the data
+// handler nor the simulation step handler of the subscriber are ever invoked concurrently.
+TEST(ITest_IoWorkerThreads, callbacks_are_not_invoked_concurrently_with_multiple_io_workers)
+{
+    SimTestHarnessArgs args;
+    args.syncParticipantNames = {"Publisher1", "Publisher2", "Subscriber"};
+    args.deferParticipantCreation = true;
+
+    SimTestHarness testHarness{args};
+
+    auto* subscriberParticipant = testHarness.GetParticipant("Subscriber", ioWorkerThreadsConfig);
+
+    PubSubSpec spec{"IoWorkerThreads", {}};
+
+    std::atomic<uint64_t> numberOfReceivedMessages{0};
+    std::atomic<int> callbacksRunning{0};
+    std::atomic<bool> invokedConcurrently{false};
+
+    const auto enterCallback = [&] {
+        if (++callbacksRunning != 1)
+        {
+            invokedConcurrently = true;
+        }
+        std::this_thread::sleep_for(100us);
+        --callbacksRunning;
+    };
+
+    subscriberParticipant->Participant()->CreateDataSubscriber(
+        "Subscriber", spec, [&](IDataSubscriber*, const DataMessageEvent&) {
+            enterCallback();
+            ++numberOfReceivedMessages;
+        });
+
+    subscriberParticipant->GetOrCreateTimeSyncService()->SetSimulationStepHandler(
+        [&](std::chrono::nanoseconds, std::chrono::nanoseconds) {
+            enterCallback();
+        },
+        stepSize);
+
+    for (const auto& publisherName : {"Publisher1", "Publisher2"})
+    {
+        auto* publisherParticipant = testHarness.GetParticipant(publisherName, ioWorkerThreadsConfig);
+        auto* publisher = publisherParticipant->Participant()->CreateDataPublisher(publisherName, spec);
+        auto* lifecycleService = publisherParticipant->GetOrCreateLifecycleService();
+        const bool stopsSimulation = std::string{publisherName} == "Publisher1";
+
+        publisherParticipant->GetOrCreateTimeSyncService()->SetSimulationStepHandler(
+            [publisher, lifecycleService, stopsSimulation](std::chrono::nanoseconds now, std::chrono::nanoseconds) {
+                const auto step = static_cast<uint64_t>(now / stepSize);
+                if (step >= numberOfSteps)
+                {
+                    if (stopsSimulation && step == numberOfSteps)
+                    {
+                        lifecycleService->Stop("Test done");
+                    }
+                    return;
+                }
+                for (int index = 0; index != 10; ++index)
+                {
+                    publisher->Publish(SerializeStep(step));
+                }
+            },
+            stepSize);
+    }
+
+    ASSERT_TRUE(testHarness.Run(30s)) << "TestSim Harness should not reach timeout";
+
+    EXPECT_EQ(numberOfReceivedMessages, 2 * 10 * numberOfSteps);
+    EXPECT_FALSE(invokedConcurrently);
+}
+
+
+} // namespace
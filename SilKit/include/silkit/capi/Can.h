@@ -426,6 +426,31 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_CanController_RemoveErrorStateChan
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_CanController_RemoveErrorStateChangeHandler_t)(SilKit_CanController* controller,
                                                                            SilKit_HandlerId handlerId);
 
+/*! \brief Add an acceptance filter for received CAN frames
+*
+* A received frame passes the filter if (frame.canId & mask) == (canId & mask) and
+* (frame.flags & flagsMask) == (flags & flagsMask). For example, flagsMask SilKit_CanFrameFlag_ide with flags 0 only
+* lets standard frames pass, and with flags SilKit_CanFrameFlag_ide only extended frames. Once a filter is added, the
+* controller only receives frames which pass at least one of its filters. The filters are announced to the other participants,
+* which do not send frames to this participant that none of its CAN controllers on the network accepts.
+*
+* The filters are applied immediately, the other participants skip sending frames once the updated filters are announced
+* to them. Filters should preferably be added before the controller is started.
+*
+* \param controller The CAN controller for which the filter should be added.
+* \param canId The CAN identifier the received frames are compared with.
+* \param mask The bits of the CAN identifier which are compared.
+* \param flags The frame flags (SilKit_CanFrameFlag) the received frames are compared with.
+* \param flagsMask The frame flags which are compared.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_CanController_AddAcceptanceFilter(
+    SilKit_CanController* controller, uint32_t canId, uint32_t mask, SilKit_CanFrameFlag flags,
+    SilKit_CanFrameFlag flagsMask);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_CanController_AddAcceptanceFilter_t)(
+    SilKit_CanController* controller, uint32_t canId, uint32_t mask, SilKit_CanFrameFlag flags,
+    SilKit_CanFrameFlag flagsMask);
+
 
 SILKIT_END_DECLS
 
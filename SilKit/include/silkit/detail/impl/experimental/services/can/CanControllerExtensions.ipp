@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "silkit/capi/Can.h"
+
+#include "silkit/detail/impl/services/can/CanController.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace Can {
+
+void AddAcceptanceFilter(SilKit::Services::Can::ICanController* canController, uint32_t canId, uint32_t mask,
+                         SilKit::Services::Can::CanFrameFlagMask flags, SilKit::Services::Can::CanFrameFlagMask flagsMask)
+{
+    auto& cppCanController = dynamic_cast<Impl::Services::Can::CanController&>(*canController);
+
+    cppCanController.ExperimentalAddAcceptanceFilter(canId, mask, flags, flagsMask);
+}
+
+} // namespace Can
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Can {
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::Can::AddAcceptanceFilter;
+} // namespace Can
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
@@ -73,6 +73,11 @@ public:
 
     inline void RemoveFrameTransmitHandler(SilKit::Util::HandlerId handlerId) override;
 
+public:
+    inline void ExperimentalAddAcceptanceFilter(uint32_t canId, uint32_t mask,
+                                                SilKit::Services::Can::CanFrameFlagMask flags,
+                                                SilKit::Services::Can::CanFrameFlagMask flagsMask);
+
 private:
     template <typename HandlerFunction>
     struct HandlerData
@@ -342,6 +347,15 @@ void CanController::RemoveFrameTransmitHandler(SilKit::Util::HandlerId handlerId
     _frameTransmitHandlers.erase(handlerId);
 }
 
+void CanController::ExperimentalAddAcceptanceFilter(uint32_t canId, uint32_t mask,
+                                                    SilKit::Services::Can::CanFrameFlagMask flags,
+                                                    SilKit::Services::Can::CanFrameFlagMask flagsMask)
+{
+    const auto returnCode =
+        SilKit_Experimental_CanController_AddAcceptanceFilter(_canController, canId, mask, flags, flagsMask);
+    ThrowOnError(returnCode);
+}
+
 } // namespace Can
 } // namespace Services
 } // namespace Impl
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+
+#include "silkit/services/can/ICanController.hpp"
+
+#include "silkit/detail/macros.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace Can {
+
+/*! \brief Add an acceptance filter for received CAN frames on a given controller.
+ *
+ * A received frame passes the filter if (frame.canId & mask) == (canId & mask) and
+ * (frame.flags & flagsMask) == (flags & flagsMask). For example, flagsMask CanFrameFlag::Ide with flags 0 only lets
+ * standard frames pass, and with flags CanFrameFlag::Ide only extended frames. Once a filter is added, the
+ * controller only receives frames which pass at least one of its filters, like the acceptance filters of a hardware
+ * CAN controller. The filters are announced to the other participants, which do not send frames to this participant
+ * that none of its CAN controllers on the network accepts.
+ *
+ * The filters are applied immediately, the other participants skip sending frames once the updated filters are
+ * announced to them. Filters should preferably be added before the controller is started.
+ *
+ * \param canController The CAN controller to add the filter to.
+ * \param canId The CAN identifier the received frames are compared with.
+ * \param mask The bits of the CAN identifier which are compared.
+ * \param flags The frame flags the received frames are compared with.
+ * \param flagsMask The frame flags which are compared.
+ */
+DETAIL_SILKIT_CPP_API void AddAcceptanceFilter(SilKit::Services::Can::ICanController* canController, uint32_t canId,
+                                               uint32_t mask, SilKit::Services::Can::CanFrameFlagMask flags,
+                                               SilKit::Services::Can::CanFrameFlagMask flagsMask);
+
+} // namespace Can
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+//! \cond DOCUMENT_HEADER_ONLY_DETAILS
+#include "silkit/detail/impl/experimental/services/can/CanControllerExtensions.ipp"
+//! \endcond
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/config/IParticipantConfiguration.hpp"
 #include "silkit/experimental/participant/ParticipantExtensions.hpp"
+#include "silkit/experimental/services/can/CanControllerExtensions.hpp"
 #include "silkit/experimental/services/lin/LinControllerExtensions.hpp"
 #include "silkit/SilKitMacros.hpp"
 
@@ -57,4 +58,7 @@ void __silkit_force_include_experimental()
     SilKit::Experimental::Services::Lin::RemoveLinSlaveConfigurationHandler(nullptr, SilKit::Util::HandlerId{});
     auto slaveConfig = SilKit::Experimental::Services::Lin::GetSlaveConfiguration(nullptr);
     SILKIT_UNUSED_ARG(slaveConfig);
+
+    // CanController extensions
+    SilKit::Experimental::Services::Can::AddAcceptanceFilter(nullptr, 0, 0, 0, 0);
 }
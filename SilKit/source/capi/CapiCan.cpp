@@ -24,6 +24,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstring>
 #include <sstream>
 
+#include "services/can/CanControllerExtensionsImpl.hpp"
+
 #include "silkit/capi/SilKit.h"
 #include "silkit/SilKit.hpp"
 #include "CapiImpl.hpp"
@@ -207,6 +209,21 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_CanController_AddAcceptanceFilter(SilKit_CanController* controller,
+                                                                                 uint32_t canId, uint32_t mask,
+                                                                                 SilKit_CanFrameFlag flags,
+                                                                                 SilKit_CanFrameFlag flagsMask)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(controller);
+
+    auto canController = reinterpret_cast<SilKit::Services::Can::ICanController*>(controller);
+    SilKit::Experimental::Services::Can::AddAcceptanceFilterImpl(canController, canId, mask, flags, flagsMask);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_CanController_SetBaudRate(SilKit_CanController* controller, uint32_t rate, uint32_t fdRate, uint32_t xlRate)
 try
 {
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "gmock/gmock.h"
 #include "silkit/capi/SilKit.h"
 #include "silkit/services/can/all.hpp"
+#include "ICanControllerExtensions.hpp"
 #include "MockParticipant.hpp"
 
 namespace {
@@ -78,7 +79,9 @@ namespace {
         return true;
     }
 
-    class MockCanController : public SilKit::Services::Can::ICanController
+    class MockCanController
+        : public SilKit::Services::Can::ICanController
+        , public SilKit::Services::Can::ICanControllerExtensions
     {
     public:
         MOCK_METHOD(void, SetBaudRate, (uint32_t rate, uint32_t fdRate, uint32_t xlRate), (override));
@@ -95,6 +98,8 @@ namespace {
         MOCK_METHOD(void, RemoveErrorStateChangeHandler, (SilKit::Services::HandlerId), (override));
         MOCK_METHOD(SilKit::Services::HandlerId, AddFrameTransmitHandler, (FrameTransmitHandler, CanTransmitStatusMask), (override));
         MOCK_METHOD(void, RemoveFrameTransmitHandler, (SilKit::Services::HandlerId), (override));
+        MOCK_METHOD(void, AddAcceptanceFilter,
+                    (uint32_t canId, uint32_t mask, CanFrameFlagMask flags, CanFrameFlagMask flagsMask), (override));
     };
 
     void SilKitCALL FrameTransmitHandler(void* /*context*/, SilKit_CanController* /*controller*/, SilKit_CanFrameTransmitEvent* /*ack*/)
@@ -203,6 +208,11 @@ namespace {
         returnCode = SilKit_CanController_RemoveFrameTransmitHandler((SilKit_CanController*)&mockController, 0);
         EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
 
+        EXPECT_CALL(mockController, AddAcceptanceFilter(0x100u, 0x7F0u, SilKit_CanFrameFlag_ide, SilKit_CanFrameFlag_ide))
+            .Times(testing::Exactly(1));
+        returnCode = SilKit_Experimental_CanController_AddAcceptanceFilter(
+            (SilKit_CanController*)&mockController, 0x100, 0x7F0, SilKit_CanFrameFlag_ide, SilKit_CanFrameFlag_ide);
+        EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
     }
 
     TEST_F(Test_CapiCan, can_controller_send_frame_no_flags)
@@ -330,6 +340,9 @@ namespace {
         EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
         returnCode = SilKit_CanController_RemoveErrorStateChangeHandler(nullptr, handlerId);
         EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+        returnCode = SilKit_Experimental_CanController_AddAcceptanceFilter(nullptr, 0x100, 0x7F0, 0, 0);
+        EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
     }
 
 TEST_F(Test_CapiCan, send_with_invalud_struct_header)
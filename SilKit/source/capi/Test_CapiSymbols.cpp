@@ -48,6 +48,7 @@ SilKit_HandlerId id;
 (void) SilKit_CanController_RemoveStateChangeHandler(nullptr, id);
 (void) SilKit_CanController_AddErrorStateChangeHandler(nullptr, nullptr, nullptr, &id);
 (void) SilKit_CanController_RemoveErrorStateChangeHandler(nullptr, id);
+(void) SilKit_Experimental_CanController_AddAcceptanceFilter(nullptr, 0, 0, 0, 0);
 (void) SilKit_DataPublisher_Create(nullptr, nullptr,"",nullptr,0);
 (void) SilKit_DataSubscriber_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
 (void) SilKit_DataPublisher_Publish(nullptr, nullptr);
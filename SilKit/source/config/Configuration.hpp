@@ -79,6 +79,8 @@ struct Logging
     bool logFromRemotes{ false };
     Services::Logging::Level flushLevel{ Services::Logging::Level::Off };
     std::vector<Sink> sinks;
+    //! Format and write the messages of the Stdout and File sinks on a dedicated thread
+    bool asynchronous{ false };
 };
 
 // ================================================================================
@@ -98,6 +100,8 @@ struct TraceSink
     Type type{ Type::Undefined };
     std::string name;
     std::string outputPath;
+    //! Write PCAP sinks from a dedicated thread, traced frames are dropped if the writer falls behind
+    bool asynchronous{ false };
 };
 
 struct TraceSource
@@ -212,14 +216,16 @@ bool operator==(const Logging& lhs, const Logging& rhs)
 {
     return lhs.logFromRemotes == rhs.logFromRemotes
         && lhs.flushLevel == rhs.flushLevel
-        && lhs.sinks == rhs.sinks;
+        && lhs.sinks == rhs.sinks
+        && lhs.asynchronous == rhs.asynchronous;
 }
 
 bool operator==(const TraceSink& lhs, const TraceSink& rhs)
 {
     return lhs.name == rhs.name
         && lhs.outputPath == rhs.outputPath
-        && lhs.type == rhs.type;
+        && lhs.type == rhs.type
+        && lhs.asynchronous == rhs.asynchronous;
 }
 
 bool operator==(const TraceSource& lhs, const TraceSource& rhs)
@@ -233,6 +233,17 @@ struct Middleware
     bool experimentalRemoteParticipantConnection{ true };
     //! Timeout for individual connection attempts (TCP, Local-Domain) and handshakes.
     double connectTimeoutSeconds{5.0};
+    //! Maximum number of queued messages which are combined into a single (vectored) socket write.
+    int sendBatchMaxMessages{1};
+    //! Maximum number of bytes which are combined into a single socket write, if more than one message is queued.
+    int sendBatchMaxBytes{64 * 1024};
+    //! Transfer data between participants on the same host through shared memory instead of local domain sockets.
+    bool enableSharedMemory{ false };
+    //! Number of threads handling received messages. With more than one thread, the messages of each remote
+    //! participant are delivered in order by one of the additional worker threads.
+    int ioWorkerThreads{1};
+    //! Messages of at least this many bytes are sent compressed to participants supporting it. Zero disables it.
+    int compressionThreshold{0};
 };
 
 // ================================================================================
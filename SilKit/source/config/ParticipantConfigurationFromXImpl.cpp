@@ -142,7 +142,10 @@ bool operator==(const Middleware& lhs, const Middleware& rhs)
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.sendBatchMaxMessages == rhs.sendBatchMaxMessages && lhs.sendBatchMaxBytes == rhs.sendBatchMaxBytes
+           && lhs.enableSharedMemory == rhs.enableSharedMemory && lhs.ioWorkerThreads == rhs.ioWorkerThreads
+           && lhs.compressionThreshold == rhs.compressionThreshold;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
@@ -109,6 +109,27 @@ TEST(Test_Validation, throw_if_replay_refers_to_unknown_source_name)
     EXPECT_THROW(Validate(cfg), SilKit::ConfigurationError);
 }
 
+TEST(Test_Validation, throw_if_asynchronous_tracesink_is_not_pcap)
+{
+    TraceSink sink;
+    sink.name = "Sink1";
+    sink.outputPath = "Bar";
+    sink.type = TraceSink::Type::Mdf4File;
+    sink.asynchronous = true;
+
+    ParticipantConfiguration cfg;
+    cfg.participantName = "P1";
+    cfg.tracing.traceSinks.emplace_back(std::move(sink));
+
+    EXPECT_THROW(Validate(cfg), SilKit::ConfigurationError);
+
+    cfg.tracing.traceSinks.at(0).type = TraceSink::Type::PcapFile;
+    EXPECT_NO_THROW(Validate(cfg));
+
+    cfg.tracing.traceSinks.at(0).type = TraceSink::Type::PcapPipe;
+    EXPECT_NO_THROW(Validate(cfg));
+}
+
 TEST(Test_Validation, throw_if_tracesink_has_empty_fields)
 {
     TraceSource source;
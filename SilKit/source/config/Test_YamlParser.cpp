@@ -182,6 +182,7 @@ Logging:
     LogName: MyLog1
   FlushLevel: Critical
   LogFromRemotes: false
+  Asynchronous: true
 HealthCheck:
   SoftResponseTimeout: 500
   HardResponseTimeout: 5000
@@ -190,6 +191,10 @@ Tracing:
   - Name: Sink1
     OutputPath: FlexrayDemo_node0.mf4
     Type: Mdf4File
+  - Name: Sink2
+    OutputPath: FlexrayDemo_node0.pcap
+    Type: PcapFile
+    Asynchronous: true
   TraceSources:
   - Name: Source1
     InputPath: path/to/Source1.mf4
@@ -207,6 +212,11 @@ Middleware:
   TcpSendBufferSize: 3456
   TcpReceiveBufferSize: 3456
   RegistryAsFallbackProxy: false
+  SendBatchMaxMessages: 16
+  SendBatchMaxBytes: 32768
+  EnableSharedMemory: true
+  IoWorkerThreads: 4
+  CompressionThreshold: 4096
 
 )raw";
 
@@ -242,14 +252,20 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.logging.sinks.at(0).type == Sink::Type::File);
     EXPECT_TRUE(config.logging.sinks.at(0).level == SilKit::Services::Logging::Level::Critical);
     EXPECT_TRUE(config.logging.sinks.at(0).logName == "MyLog1");
+    EXPECT_TRUE(config.logging.asynchronous);
 
     EXPECT_TRUE(config.healthCheck.softResponseTimeout.value() == 500ms);
     EXPECT_TRUE(config.healthCheck.hardResponseTimeout.value() == 5000ms);
 
-    EXPECT_TRUE(config.tracing.traceSinks.size() == 1);
+    EXPECT_TRUE(config.tracing.traceSinks.size() == 2);
     EXPECT_TRUE(config.tracing.traceSinks.at(0).name == "Sink1");
     EXPECT_TRUE(config.tracing.traceSinks.at(0).outputPath == "FlexrayDemo_node0.mf4");
     EXPECT_TRUE(config.tracing.traceSinks.at(0).type == TraceSink::Type::Mdf4File);
+    EXPECT_FALSE(config.tracing.traceSinks.at(0).asynchronous);
+    EXPECT_TRUE(config.tracing.traceSinks.at(1).name == "Sink2");
+    EXPECT_TRUE(config.tracing.traceSinks.at(1).outputPath == "FlexrayDemo_node0.pcap");
+    EXPECT_TRUE(config.tracing.traceSinks.at(1).type == TraceSink::Type::PcapFile);
+    EXPECT_TRUE(config.tracing.traceSinks.at(1).asynchronous);
     EXPECT_TRUE(config.tracing.traceSources.size() == 1);
     EXPECT_TRUE(config.tracing.traceSources.at(0).name == "Source1");
     EXPECT_TRUE(config.tracing.traceSources.at(0).inputPath == "path/to/Source1.mf4");
@@ -267,6 +283,11 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.middleware.tcpReceiveBufferSize == 3456);
     EXPECT_TRUE(config.middleware.tcpSendBufferSize == 3456);
     EXPECT_FALSE(config.middleware.registryAsFallbackProxy);
+    EXPECT_TRUE(config.middleware.sendBatchMaxMessages == 16);
+    EXPECT_TRUE(config.middleware.sendBatchMaxBytes == 32768);
+    EXPECT_TRUE(config.middleware.enableSharedMemory);
+    EXPECT_TRUE(config.middleware.ioWorkerThreads == 4);
+    EXPECT_TRUE(config.middleware.compressionThreshold == 4096);
 }
 
 const auto emptyConfiguration = R"raw(
@@ -50,6 +50,11 @@ void ValidateTraceSinks(const SilKit::Config::v1::ParticipantConfiguration& conf
             throw SilKit::ConfigurationError{ "On Participant " + configuration.participantName + 
                 ": TraceSink \"OutputPath\" must not be empty!" };
         }
+        if (sink.asynchronous && sink.type != TraceSink::Type::PcapFile && sink.type != TraceSink::Type::PcapPipe)
+        {
+            throw SilKit::ConfigurationError{ "On Participant " + configuration.participantName +
+                ": TraceSink \"Asynchronous\" is only supported for the types PcapFile and PcapPipe!" };
+        }
         sinkNames.insert(sink.name);
     }
 
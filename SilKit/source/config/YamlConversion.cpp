@@ -82,6 +82,7 @@ Node Converter::encode(const Logging& obj)
 
     non_default_encode(obj.logFromRemotes, node, "LogFromRemotes", defaultLogger.logFromRemotes);
     non_default_encode(obj.flushLevel, node, "FlushLevel", defaultLogger.flushLevel);
+    non_default_encode(obj.asynchronous, node, "Asynchronous", defaultLogger.asynchronous);
     // ParticipantConfiguration.schema.json: this is a required property:
     node["Sinks"] = obj.sinks;
 
@@ -92,6 +93,7 @@ bool Converter::decode(const Node& node, Logging& obj)
 {
     optional_decode(obj.logFromRemotes, node, "LogFromRemotes");
     optional_decode(obj.flushLevel, node, "FlushLevel");
+    optional_decode(obj.asynchronous, node, "Asynchronous");
     optional_decode(obj.sinks, node, "Sinks");
     return true;
 }
@@ -797,9 +799,12 @@ template<>
 Node Converter::encode(const TraceSink& obj)
 {
     Node node;
+    static const TraceSink defaultTraceSink{};
+
     node["Name"] = obj.name;
     node["Type"] = obj.type;
     node["OutputPath"] = obj.outputPath;
+    non_default_encode(obj.asynchronous, node, "Asynchronous", defaultTraceSink.asynchronous);
     // Only serialize if disabled
     //if (!obj.enabled)
     //{
@@ -814,6 +819,7 @@ bool Converter::decode(const Node& node, TraceSink& obj)
     obj.name = parse_as<std::string>(node["Name"]);
     obj.type = parse_as<decltype(obj.type)>(node["Type"]);
     obj.outputPath = parse_as<decltype(obj.outputPath)>(node["OutputPath"]);
+    optional_decode(obj.asynchronous, node, "Asynchronous");
     //if (node["Enabled"])
     //{
     //    obj.enabled = parse_as<decltype(obj.enabled)>(node["Enabled"]);
@@ -959,6 +965,11 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy", defaultObj.registryAsFallbackProxy);
     non_default_encode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection", defaultObj.experimentalRemoteParticipantConnection);
     non_default_encode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds", defaultObj.connectTimeoutSeconds);
+    non_default_encode(obj.sendBatchMaxMessages, node, "SendBatchMaxMessages", defaultObj.sendBatchMaxMessages);
+    non_default_encode(obj.sendBatchMaxBytes, node, "SendBatchMaxBytes", defaultObj.sendBatchMaxBytes);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
+    non_default_encode(obj.compressionThreshold, node, "CompressionThreshold", defaultObj.compressionThreshold);
     return node;
 }
 template<>
@@ -975,6 +986,11 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
     optional_decode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection");
     optional_decode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds");
+    optional_decode(obj.sendBatchMaxMessages, node, "SendBatchMaxMessages");
+    optional_decode(obj.sendBatchMaxBytes, node, "SendBatchMaxBytes");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
+    optional_decode(obj.compressionThreshold, node, "CompressionThreshold");
     return true;
 }
 
@@ -46,6 +46,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
             {"Name"},
             {"OutputPath"},
             {"Type"},
+            {"Asynchronous"},
         }
     );
     YamlSchemaElem traceSources("TraceSources",
@@ -59,6 +60,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
         {
             {"LogFromRemotes"},
             {"FlushLevel"},
+            {"Asynchronous"},
             {"Sinks", {
                     {"Type"},
                     {"Level"},
@@ -229,6 +231,11 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"RegistryAsFallbackProxy"},
                 {"ExperimentalRemoteParticipantConnection"},
                 {"ConnectTimeoutSeconds"},
+                {"SendBatchMaxMessages"},
+                {"SendBatchMaxBytes"},
+                {"EnableSharedMemory"},
+                {"IoWorkerThreads"},
+                {"CompressionThreshold"},
             }
         }
     };
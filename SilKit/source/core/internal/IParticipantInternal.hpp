@@ -124,6 +124,7 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Discovery::ParticipantDiscoveryEvent& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Discovery::ServiceDiscoveryEvent& msg) = 0;
@@ -176,6 +177,7 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Logging::LogMsgBatch& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Discovery::ParticipantDiscoveryEvent& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Discovery::ServiceDiscoveryEvent& msg) = 0;
@@ -201,6 +203,13 @@ public:
         const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
         Services::PubSub::DataMessageHandler callback,
         Services::PubSub::IDataSubscriber* parent) -> Services::PubSub::DataSubscriberInternal*  = 0;
+    // Let an existing internal DataSubscriber also receive the data of another matching publisher
+    virtual void AddDataSubscriberInternalLink(Services::PubSub::DataSubscriberInternal* internalSubscriber,
+                                               const std::string& linkName) = 0;
+    // Undo AddDataSubscriberInternalLink, the connected peers are asked to stop sending the data of the link and peers
+    // connecting afterwards are not asked for it
+    virtual void RemoveDataSubscriberInternalLink(Services::PubSub::DataSubscriberInternal* internalSubscriber,
+                                                  const std::string& linkName) = 0;
 
     // Internal Rpc server that is only created on a matching rpc connection
     virtual auto CreateRpcServerInternal(const std::string& functionName, const std::string& linkName,
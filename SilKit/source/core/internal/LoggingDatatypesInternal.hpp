@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <string>
 #include <sstream>
 #include <ostream>
+#include <vector>
 
 #include "silkit/services/logging/LoggingDatatypes.hpp"
 #include "silkit/services/logging/string_utils.hpp"
@@ -55,8 +56,18 @@ struct LogMsg
     std::string payload;
 };
 
+/*! \brief Multiple log entries, which are sent together as one message
+ *
+ * Strings repeated between the entries (logger names, file and function names) are transmitted only once per batch.
+ */
+struct LogMsgBatch
+{
+    std::vector<LogMsg> messages;
+};
+
 inline bool operator==(const SourceLoc& lhs, const SourceLoc& rhs);
 inline bool operator==(const LogMsg& lhs, const LogMsg& rhs);
+inline bool operator==(const LogMsgBatch& lhs, const LogMsgBatch& rhs);
 
 inline std::string to_string(const SourceLoc& sourceLoc);
 inline std::ostream& operator<<(std::ostream& out, const SourceLoc& sourceLoc);
@@ -64,6 +75,9 @@ inline std::ostream& operator<<(std::ostream& out, const SourceLoc& sourceLoc);
 inline std::string to_string(const LogMsg& msg);
 inline std::ostream& operator<<(std::ostream& out, const LogMsg& msg);
 
+inline std::string to_string(const LogMsgBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const LogMsgBatch& msg);
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -79,6 +93,11 @@ inline bool operator==(const LogMsg& lhs, const LogMsg& rhs)
            && lhs.source == rhs.source && lhs.payload == rhs.payload;
 }
 
+inline bool operator==(const LogMsgBatch& lhs, const LogMsgBatch& rhs)
+{
+    return lhs.messages == rhs.messages;
+}
+
 std::string to_string(const SourceLoc& sourceLoc)
 {
     std::stringstream outStream;
@@ -108,6 +127,18 @@ std::ostream& operator<<(std::ostream& out, const LogMsg& msg)
     return out;
 }
 
+std::string to_string(const LogMsgBatch& msg)
+{
+    std::stringstream outStream;
+    outStream << msg;
+    return outStream.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const LogMsgBatch& msg)
+{
+    return out << "LogMsgBatch{messages=" << msg.messages.size() << "}";
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
@@ -72,6 +72,11 @@ public:
     // Constructors and Destructor
     inline MessageBuffer() = default;
     inline MessageBuffer(std::vector<uint8_t> data);
+    inline MessageBuffer(std::shared_ptr<const std::vector<uint8_t>> data);
+
+    //! Create a buffer which only counts the bytes written to it, without storing them. Used to compute the exact
+    //! serialized size of a message before writing it into a buffer of that capacity.
+    static inline auto MakeSizeCounter() -> MessageBuffer;
 
     MessageBuffer(const MessageBuffer& other) = default;
     MessageBuffer(MessageBuffer&& other) = default;
@@ -92,7 +97,7 @@ public:
 
     //! Set the format version to use for ser/des.
     inline void SetProtocolVersion(ProtocolVersion version);
-    inline auto GetProtocolVersion() -> ProtocolVersion;
+    inline auto GetProtocolVersion() const -> ProtocolVersion;
 
     inline void SetReadPos(size_t newReadPos);
 
@@ -103,6 +108,8 @@ public:
     //! \brief Return the underlying data storage by std::move and reset pointers
     inline auto ReleaseStorage() -> std::vector<uint8_t>;
     inline auto RemainingBytesLeft() const noexcept -> size_t;
+    //! Number of bytes written so far
+    inline auto WrittenSize() const noexcept -> size_t;
 public:
     // ----------------------------------------
     // Elementary streaming operators
@@ -112,23 +119,17 @@ public:
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator<<(IntegerT t)
     {
-        if (_wPos + sizeof(IntegerT) > _storage.size())
-        {
-            _storage.resize(_storage.size() + sizeof(IntegerT));
-        }
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(IntegerT));
-
-        _wPos += sizeof(IntegerT);
+        WriteBytes(&t, sizeof(IntegerT));
 
         return *this;
     }
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        if (_rPos + sizeof(IntegerT) > ReadStorage().size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, ReadStorage().data() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -141,13 +142,7 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_wPos + sizeof(DoubleT) > _storage.size())
-        {
-            _storage.resize(_storage.size() + sizeof(DoubleT));
-        }
-
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(DoubleT));
-        _wPos += sizeof(DoubleT);
+        WriteBytes(&t, sizeof(DoubleT));
 
         return *this;
     }
@@ -156,10 +151,10 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        if (_rPos + sizeof(DoubleT) > ReadStorage().size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, ReadStorage().data() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -203,6 +198,8 @@ public:
     inline MessageBuffer& operator<<(const Util::SharedVector<ValueT>& sharedData);
     template <typename ValueT>
     inline MessageBuffer& operator>>(Util::SharedVector<ValueT>& sharedData);
+    //! Deserialized bytes refer to the storage of this buffer, instead of being copied.
+    inline MessageBuffer& operator>>(Util::SharedVector<uint8_t>& sharedData);
     // --------------------------------------------------------------------------------
     // Util::Span<T>
     inline MessageBuffer& operator<<(const Util::Span<const uint8_t>& sharedData);
@@ -250,15 +247,32 @@ public:
 public:
     void IncreaseCapacity(size_t capacity)
     {
+        if (_sizeCounterOnly)
+        {
+            return;
+        }
+        UnshareStorage();
         _storage.reserve( _storage.size() + capacity);
     }
+private:
+    // ----------------------------------------
+    // private methods
+    inline auto ReadStorage() const -> const std::vector<uint8_t>&;
+    //! Write raw bytes at the write position, growing the storage as needed
+    inline void WriteBytes(const void* data, size_t size);
+    inline void UnshareStorage();
+    inline auto ShareStorage() -> const std::shared_ptr<const std::vector<uint8_t>>&;
+
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    //! Read-only storage, which is shared with deserialized payloads. If set, it is used instead of _storage.
+    std::shared_ptr<const std::vector<uint8_t>> _sharedStorage;
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
+    bool _sizeCounterOnly{false};
 };
 
 // ================================================================================
@@ -271,16 +285,84 @@ MessageBuffer::MessageBuffer(std::vector<uint8_t> data)
 {
 }
 
+MessageBuffer::MessageBuffer(std::shared_ptr<const std::vector<uint8_t>> data)
+    : _sharedStorage{std::move(data)}
+    , _wPos{_sharedStorage->size()}
+    , _rPos{0u}
+{
+}
+
+auto MessageBuffer::MakeSizeCounter() -> MessageBuffer
+{
+    MessageBuffer buffer;
+    buffer._sizeCounterOnly = true;
+    return buffer;
+}
+
 auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
+    UnshareStorage();
     _wPos = 0u;
     _rPos = 0u;
     return std::move(_storage);
 }
 
+auto MessageBuffer::ReadStorage() const -> const std::vector<uint8_t>&
+{
+    return _sharedStorage ? *_sharedStorage : _storage;
+}
+
+void MessageBuffer::WriteBytes(const void* data, size_t size)
+{
+    if (!_sizeCounterOnly && size != 0)
+    {
+        UnshareStorage();
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (_wPos == _storage.size())
+        {
+            _storage.insert(_storage.end(), bytes, bytes + size);
+        }
+        else
+        {
+            if (_wPos + size > _storage.size())
+            {
+                _storage.resize(_wPos + size);
+            }
+            std::memcpy(_storage.data() + _wPos, bytes, size);
+        }
+    }
+
+    _wPos += size;
+}
+
+void MessageBuffer::UnshareStorage()
+{
+    if (_sharedStorage)
+    {
+        _storage = *_sharedStorage;
+        _sharedStorage.reset();
+    }
+}
+
+auto MessageBuffer::ShareStorage() -> const std::shared_ptr<const std::vector<uint8_t>>&
+{
+    if (!_sharedStorage)
+    {
+        _sharedStorage = std::make_shared<const std::vector<uint8_t>>(std::move(_storage));
+        _storage = std::vector<uint8_t>{};
+    }
+    return _sharedStorage;
+}
+
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    return (_rPos > ReadStorage().size()) ? 0 : (ReadStorage().size() - _rPos);
+}
+
+inline auto MessageBuffer::WrittenSize() const noexcept -> size_t
+{
+    return _wPos;
 }
 
 // --------------------------------------------------------------------------------
@@ -293,14 +375,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::string& str)
     IncreaseCapacity(sizeof(uint32_t) + str.size());
 
     *this << static_cast<uint32_t>(str.length());
-
-    if (_wPos + str.size() > _storage.size())
-    {
-        _storage.resize(_wPos + str.size());
-    }
-
-    std::copy(str.begin(), str.end(), _storage.begin() + _wPos);
-    _wPos += str.size();
+    WriteBytes(str.data(), str.size());
 
     return *this;
 }
@@ -309,10 +384,10 @@ MessageBuffer& MessageBuffer::operator>>(std::string& str)
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    if (_rPos + strLength > ReadStorage().size())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + _rPos, _storage.begin() + _rPos + strLength);
+    str = std::string(ReadStorage().begin() + _rPos, ReadStorage().begin() + _rPos + strLength);
     _rPos += strLength;
 
     return *this;
@@ -330,10 +405,10 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > ReadStorage().size())
         throw end_of_buffer{};
 
-    vector = std::vector<uint8_t>(_storage.begin() + _rPos, _storage.begin() + _rPos + vectorSize);
+    vector = std::vector<uint8_t>(ReadStorage().begin() + _rPos, ReadStorage().begin() + _rPos + vectorSize);
     _rPos += vectorSize;
 
     return *this;
@@ -364,7 +439,7 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > ReadStorage().size())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -393,15 +468,7 @@ inline MessageBuffer& MessageBuffer::operator<<(const Util::Span<const uint8_t>&
     IncreaseCapacity(sizeof(uint32_t) + span.size());
 
     *this << static_cast<uint32_t>(span.size());
-
-
-    if (_wPos + span.size() > _storage.size())
-    {
-        _storage.resize(_wPos + span.size());
-    }
-
-    std::copy(span.begin(), span.end(), _storage.begin() + _wPos);
-    _wPos += span.size();
+    WriteBytes(span.data(), span.size());
     return *this;
 }
 
@@ -443,6 +510,21 @@ inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& shar
     return *this;
 }
 
+inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<uint8_t>& sharedData)
+{
+    uint32_t size{0u};
+    *this >> size;
+
+    if (_rPos + size > ReadStorage().size())
+        throw end_of_buffer{};
+
+    const auto& storage = ShareStorage();
+    sharedData = Util::SharedVector<uint8_t>{storage, Util::Span<const uint8_t>{storage->data() + _rPos, size}};
+    _rPos += size;
+
+    return *this;
+}
+
 // --------------------------------------------------------------------------------
 // std::array<uint8_t, SIZE>
 template<size_t SIZE>
@@ -451,23 +533,17 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
     if (array.size() > std::numeric_limits<uint32_t>::max())
         throw end_of_buffer{};
 
-    if (_wPos + array.size() > _storage.size())
-    {
-        _storage.resize(_wPos + array.size());
-    }
-
-    std::copy(array.begin(), array.end(), _storage.begin() + _wPos);
-    _wPos += array.size();
+    WriteBytes(array.data(), array.size());
 
     return *this;
 }
 template<size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > ReadStorage().size())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(ReadStorage().begin() + _rPos, ReadStorage().begin() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -489,7 +565,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template<typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > ReadStorage().size())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -614,7 +690,7 @@ inline void MessageBuffer::SetProtocolVersion(ProtocolVersion version)
 {
     _protocolVersion = version;
 }
-inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
+inline auto MessageBuffer::GetProtocolVersion() const -> ProtocolVersion
 {
     return _protocolVersion;
 }
@@ -622,7 +698,7 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const  -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return ReadStorage();
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
@@ -40,6 +40,9 @@ const std::string controllerTypeEthernet = "Ethernet";
 const std::string controllerTypeFlexray = "FlexRay";
 const std::string controllerTypeLin = "LIN";
 
+// CAN supplementalData keys
+const std::string supplKeyCanControllerAcceptanceFilters = "Can::acceptanceFilters";
+
 // PubSub types and supplementalData keys
 const std::string controllerTypeDataPublisher = "DataPublisher";
 const std::string supplKeyDataPublisherTopic = "PubSub::topic";
@@ -38,6 +38,7 @@ template <class MsgT> struct SilKitMsgTraitSerdesName { static constexpr const c
     }
 
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Logging::LogMsg, "LOGMSG" );
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Logging::LogMsgBatch, "LOGMSGBATCH" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::SystemCommand, "SYSTEMCOMMAND" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::ParticipantStatus, "PARTICIPANTSTATUS" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::WorkflowConfiguration, "WORKFLOWCONFIGURATION" );
@@ -37,6 +37,7 @@ template <class MsgT> struct SilKitMsgTraitVersion { static constexpr VersionT V
     }
 
 DefineSilKitMsgTrait_Version(SilKit::Services::Logging::LogMsg, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Logging::LogMsgBatch, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::SystemCommand, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::ParticipantStatus, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::WorkflowConfiguration, 1);
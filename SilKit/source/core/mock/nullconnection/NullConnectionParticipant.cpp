@@ -47,9 +47,29 @@ struct NullConnection
     {
     }
 
+    template <class SilKitServiceT>
+    inline void RegisterSilKitServiceOnNetwork(SilKitServiceT* /*service*/, const std::string& /*networkName*/)
+    {
+    }
+
+    template <class SilKitServiceT>
+    inline void UnregisterSilKitServiceFromNetwork(SilKitServiceT* /*service*/, const std::string& /*networkName*/)
+    {
+    }
+
     template <class SilKitServiceT>
     inline void SetHistoryLengthForLink(size_t /*history*/, SilKitServiceT* /*service*/) {}
 
+    template <class SilKitMessageT>
+    void AddRemoteServiceToLink(const std::string& /*networkName*/, const ServiceDescriptor& /*serviceDescriptor*/)
+    {
+    }
+
+    template <class SilKitMessageT>
+    void RemoveRemoteServiceFromLink(const std::string& /*networkName*/, const ServiceDescriptor& /*serviceDescriptor*/)
+    {
+    }
+
     template<typename SilKitMessageT>
     void SendMsg(const Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/) {}
 
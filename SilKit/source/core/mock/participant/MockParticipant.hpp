@@ -134,8 +134,9 @@ public:
     MOCK_METHOD(void, NotifyServiceCreated, (const ServiceDescriptor& serviceDescriptor), (override));
     MOCK_METHOD(void, NotifyServiceRemoved, (const ServiceDescriptor& serviceDescriptor), (override));
     MOCK_METHOD(void, RegisterServiceDiscoveryHandler, (SilKit::Core::Discovery::ServiceDiscoveryHandler handler), (override));
+    MOCK_METHOD(void, RegisterServiceUpdateHandler, (SilKit::Core::Discovery::ServiceUpdateHandler handler), (override));
     MOCK_METHOD(void, RegisterSpecificServiceDiscoveryHandler,
-                (SilKit::Core::Discovery::ServiceDiscoveryHandler handler, const std::string& controllerType,
+                (SilKit::Core::Discovery::SpecificServiceDiscoveryHandler handler, const std::string& controllerType,
                  const std::string& topic, const std::vector<SilKit::Services::MatchingLabel>& labels),
                 (override));
     MOCK_METHOD(std::vector<ServiceDescriptor>, GetServices, (), (const, override));
@@ -218,6 +219,14 @@ public:
     {
         return nullptr;
     }
+    void AddDataSubscriberInternalLink(Services::PubSub::DataSubscriberInternal* /*internalSubscriber*/,
+                                       const std::string& /*linkName*/) override
+    {
+    }
+    void RemoveDataSubscriberInternalLink(Services::PubSub::DataSubscriberInternal* /*internalSubscriber*/,
+                                          const std::string& /*linkName*/) override
+    {
+    }
 
     auto CreateRpcClient(const std::string& /*controllerName*/, const SilKit::Services::Rpc::RpcSpec& /*dataSpec*/,
                          SilKit::Services::Rpc::RpcCallResultHandler /*handler*/) -> SilKit::Services::Rpc::IRpcClient* override
@@ -301,6 +310,7 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Logging::LogMsg&& /*msg*/)  override{}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsg& /*msg*/)  override{}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsgBatch& /*msg*/)  override{}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ServiceDiscoveryEvent& /*msg*/) override {}
@@ -354,6 +364,7 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, Services::Logging::LogMsg&& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Logging::LogMsg& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Logging::LogMsgBatch& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Discovery::ServiceDiscoveryEvent& /*msg*/) override {}
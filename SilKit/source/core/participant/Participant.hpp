@@ -27,6 +27,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <vector>
 #include <unordered_map>
 #include <map>
+#include <mutex>
+#include <unordered_set>
 #include <tuple>
 
 #include "silkit/services/all.hpp"
@@ -38,6 +40,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 // Interfaces relying on I_SilKit_Core_Internal
 #include "IMsgForLogMsgSender.hpp"
 #include "IMsgForLogMsgReceiver.hpp"
+#include "LogMsgSender.hpp"
 
 #include "IMsgForCanSimulator.hpp"
 #include "IMsgForCanController.hpp"
@@ -102,6 +105,7 @@ public:
     Participant(const Participant&) = default;
     Participant(Participant&&) = default;
     Participant(Config::ParticipantConfiguration participantConfig, ProtocolVersion version = CurrentProtocolVersion());
+    ~Participant() override;
 
 public:
     // ----------------------------------------
@@ -135,6 +139,10 @@ public:
                                       const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
                                       Services::PubSub::DataMessageHandler callback, Services::PubSub::IDataSubscriber* parent)
         -> Services::PubSub::DataSubscriberInternal* override;
+    void AddDataSubscriberInternalLink(Services::PubSub::DataSubscriberInternal* internalSubscriber,
+                                       const std::string& linkName) override;
+    void RemoveDataSubscriberInternalLink(Services::PubSub::DataSubscriberInternal* internalSubscriber,
+                                          const std::string& linkName) override;
 
     auto CreateRpcClient(const std::string& canonicalName, const SilKit::Services::Rpc::RpcSpec& dataSpec, Services::Rpc::RpcCallResultHandler handler)
         -> Services::Rpc::IRpcClient* override;
@@ -202,6 +210,7 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsgBatch& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageEvent& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) override;
@@ -253,6 +262,7 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Logging::LogMsgBatch& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::PubSub::WireDataMessageEvent& msg) override;
 
@@ -370,6 +380,7 @@ private:
     std::vector<std::unique_ptr<ITraceMessageSink>> _traceSinks;
     std::unique_ptr<Tracing::ReplayScheduler> _replayScheduler;
     std::unique_ptr<RequestReply::ParticipantReplies> _participantReplies;
+    Services::Logging::LogMsgSender* _logMsgSender{nullptr};
 
     std::tuple<
         ControllerMap<Services::Can::IMsgForCanController>,
@@ -394,6 +405,10 @@ private:
 
     std::atomic<EndpointId> _localEndpointId{ 0 };
 
+    // CAN networks whose remote CAN controllers are forwarded to the CAN frame link (see CreateCanController)
+    std::mutex _canFrameLinkNetworksMutex;
+    std::unordered_set<std::string> _canFrameLinkNetworks;
+
     std::tuple<
         Services::Can::IMsgForCanSimulator*,
         Services::Ethernet::IMsgForEthSimulator*,
@@ -90,12 +90,23 @@ Participant<SilKitConnectionT>::Participant(Config::ParticipantConfiguration par
     //  this will cause a fairly unintuitive exception in spdlog.
     _logger = std::make_unique<Services::Logging::Logger>(GetParticipantName(), _participantConfig.logging);
     _connection.SetLogger(_logger.get());
+    _timeProvider.SetLogger(_logger.get());
 
     Logging::Info(_logger.get(), "Creating participant '{}' at '{}', SIL Kit version: {}", GetParticipantName(),
                   _participantConfig.middleware.registryUri, Version::StringImpl());
 
 }
 
+template <class SilKitConnectionT>
+Participant<SilKitConnectionT>::~Participant()
+{
+    // The connection is destroyed before the controllers, pending remote log messages must be sent while it is alive
+    if (_logMsgSender)
+    {
+        _logMsgSender->DisableBatching();
+    }
+}
+
 
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::JoinSilKitSimulation()
@@ -166,6 +177,7 @@ void Participant<SilKitConnectionT>::SetupRemoteLogging()
             config.network = "default";
             auto&& logMsgSender = CreateController<Services::Logging::LogMsgSender>(
                 config, std::move(supplementalData), true);
+            _logMsgSender = logMsgSender;
 
             logger->RegisterRemoteLogging([logMsgSender](Services::Logging::LogMsg logMsg) {
 
@@ -251,6 +263,56 @@ auto Participant<SilKitConnectionT>::CreateCanController(const std::string& cano
 
     controller->RegisterServiceDiscovery();
 
+    // The CAN frame link skips remote participants whose CAN controllers do not accept a frame. The remote CAN
+    // controllers are forwarded to the link once per network, regardless of the number of local controllers on it.
+    const auto& canNetworkName = controllerConfig.network.value();
+    bool isFirstControllerOnNetwork{false};
+    {
+        std::lock_guard<decltype(_canFrameLinkNetworksMutex)> lock{_canFrameLinkNetworksMutex};
+        isFirstControllerOnNetwork = _canFrameLinkNetworks.insert(canNetworkName).second;
+    }
+
+    if (isFirstControllerOnNetwork)
+    {
+        auto isRemoteCanController = [this, canNetworkName](const ServiceDescriptor& serviceDescriptor) {
+            std::string controllerType;
+            return serviceDescriptor.GetNetworkName() == canNetworkName
+                   && serviceDescriptor.GetParticipantName() != GetParticipantName()
+                   && serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType)
+                   && controllerType == Discovery::controllerTypeCan;
+        };
+
+        // the update handler is registered first, the discovery handler is then notified about the current services
+        GetServiceDiscovery()->RegisterServiceUpdateHandler(
+            [this, canNetworkName, isRemoteCanController](const ServiceDescriptor& serviceDescriptor) {
+                if (isRemoteCanController(serviceDescriptor))
+                {
+                    _connection.template AddRemoteServiceToLink<Can::WireCanFrameEvent>(canNetworkName,
+                                                                                         serviceDescriptor);
+                }
+            });
+
+        GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
+            [this, canNetworkName, isRemoteCanController](Discovery::ServiceDiscoveryEvent::Type discoveryType,
+                                                          const ServiceDescriptor& serviceDescriptor) {
+                if (!isRemoteCanController(serviceDescriptor))
+                {
+                    return;
+                }
+
+                if (discoveryType == Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
+                {
+                    _connection.template AddRemoteServiceToLink<Can::WireCanFrameEvent>(canNetworkName,
+                                                                                         serviceDescriptor);
+                }
+                else
+                {
+                    _connection.template RemoveRemoteServiceFromLink<Can::WireCanFrameEvent>(canNetworkName,
+                                                                                              serviceDescriptor);
+                }
+            });
+    }
+
     Logging::Trace(GetLogger(), "Created CAN controller '{}' for network '{}' with service name '{}'",
                    controllerConfig.name, controllerConfig.network.value(),
                    controller->GetServiceDescriptor().to_string());
@@ -408,6 +470,20 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(const std::str
     return controller;
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::AddDataSubscriberInternalLink(
+    Services::PubSub::DataSubscriberInternal* internalSubscriber, const std::string& linkName)
+{
+    _connection.RegisterSilKitServiceOnNetwork(internalSubscriber, linkName);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::RemoveDataSubscriberInternalLink(
+    Services::PubSub::DataSubscriberInternal* internalSubscriber, const std::string& linkName)
+{
+    _connection.UnregisterSilKitServiceFromNetwork(internalSubscriber, linkName);
+}
+
 static inline auto FormatLabelsForLogging(const std::vector<MatchingLabel>& labels) -> std::string
 {
     std::ostringstream os;
@@ -1143,6 +1219,12 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Servi
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Discovery::ParticipantDiscoveryEvent& msg)
 {
@@ -1404,6 +1486,12 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Logging::LogMsgBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Discovery::ParticipantDiscoveryEvent& msg)
 {
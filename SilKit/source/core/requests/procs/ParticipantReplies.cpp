@@ -80,8 +80,11 @@ void ParticipantReplies::SetRequestReplyServiceEndpoint(IServiceEndpoint* reques
 void ParticipantReplies::ReceiveCall(IRequestReplyService* requestReplyService, Util::Uuid callUuid,
                                      std::vector<uint8_t> /*callData*/)
 {
-    // Directly reply the call
-    requestReplyService->SubmitCallReturn(callUuid, _functionType, {}, CallReturnStatus::Success);
+    // Reply deferred, after the work already queued on the IO context: Subscriptions triggered by previously received
+    // service announcements (e.g., to the link of a new publisher) are queued there and must reach the caller first.
+    _participant->ExecuteDeferred([this, requestReplyService, callUuid] {
+        requestReplyService->SubmitCallReturn(callUuid, _functionType, {}, CallReturnStatus::Success);
+    });
 }
 
 void ParticipantReplies::ReceiveCallReturn(std::string fromParticipant, Util::Uuid callUuid, std::vector<uint8_t> /*callReturnData*/, CallReturnStatus /*callReturnStatus*/)
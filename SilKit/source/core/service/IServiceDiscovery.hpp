@@ -33,6 +33,14 @@ namespace Discovery {
 using ServiceDiscoveryHandler =
     std::function<void(ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor&)>;
 
+using ServiceUpdateHandler = std::function<void(const ServiceDescriptor&)>;
+
+//! Handler for pre-filtered service discovery events, which also receives the matching labels of the service. The
+//! labels are parsed once per service by the service discovery and are sorted by their key.
+using SpecificServiceDiscoveryHandler =
+    std::function<void(ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor&,
+                       const std::vector<SilKit::Services::MatchingLabel>& labels)>;
+
 class IServiceDiscovery
 {
 public:
@@ -44,10 +52,12 @@ public:
     virtual void NotifyServiceRemoved(const ServiceDescriptor& serviceDescriptor) = 0;
     //!< Register a handler for asynchronous service creation notifications
     virtual void RegisterServiceDiscoveryHandler(ServiceDiscoveryHandler handler) = 0;
+    //!< Register a handler for known services which are announced again with changed supplemental data
+    virtual void RegisterServiceUpdateHandler(ServiceUpdateHandler handler) = 0;
     //!< Register a handler for service creation notifications for a specific controllerTypeName, 
     //!< associated supplDataKey and given supplDataValue 
     virtual void RegisterSpecificServiceDiscoveryHandler(
-        ServiceDiscoveryHandler handler, const std::string& controllerType, const std::string& topic,
+        SpecificServiceDiscoveryHandler handler, const std::string& controllerType, const std::string& topic,
         const std::vector<SilKit::Services::MatchingLabel>& labels) = 0;
     //!< Get the currently known created services on other participants
     virtual std::vector<ServiceDescriptor> GetServices() const = 0;
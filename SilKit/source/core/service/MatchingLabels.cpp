@@ -0,0 +1,50 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "MatchingLabels.hpp"
+#include "YamlParser.hpp"
+
+#include <algorithm>
+
+namespace SilKit {
+namespace Core {
+namespace Discovery {
+
+auto ParseMatchingLabels(const ServiceDescriptor& serviceDescriptor, const std::string& labelsKey)
+    -> std::vector<SilKit::Services::MatchingLabel>
+{
+    std::string labelsStr;
+    if (!serviceDescriptor.GetSupplementalDataItem(labelsKey, labelsStr))
+    {
+        return {};
+    }
+
+    auto labels = SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
+
+    // stable, so the first of duplicate keys stays first
+    std::stable_sort(labels.begin(), labels.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.key < rhs.key; });
+    return labels;
+}
+
+} // namespace Discovery
+} // namespace Core
+} // namespace SilKit
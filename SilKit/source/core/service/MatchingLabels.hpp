@@ -0,0 +1,42 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "silkit/services/datatypes.hpp"
+
+#include "ServiceDescriptor.hpp"
+
+namespace SilKit {
+namespace Core {
+namespace Discovery {
+
+//! Matching labels stored in the supplemental data item with the given key, sorted by their key (empty, if the item
+//! does not exist).
+auto ParseMatchingLabels(const ServiceDescriptor& serviceDescriptor, const std::string& labelsKey)
+    -> std::vector<SilKit::Services::MatchingLabel>;
+
+} // namespace Discovery
+} // namespace Core
+} // namespace SilKit
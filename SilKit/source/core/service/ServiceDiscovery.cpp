@@ -29,6 +29,7 @@ namespace Discovery {
 ServiceDiscovery::ServiceDiscovery(IParticipantInternal* participant, const std::string& participantName)
     : _participant{participant}
     , _participantName{participantName}
+    , _participantId{SilKit::Util::Hash::Hash(participantName)}
 {
 }
 
@@ -62,24 +63,19 @@ void ServiceDiscovery::OnParticpantAddition(const ParticipantDiscoveryEvent& msg
 {
     // Service announcement are sent when a new participant joins the simulation
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
-    auto&& fromParticipant = msg.participantName;
-    auto&& announcementMap = _servicesByParticipant[fromParticipant];
+    auto&& announcementMap = _servicesByParticipant[SilKit::Util::Hash::Hash(msg.participantName)];
 
     for (auto&& serviceDescriptor : msg.services)
     {
         // Check if already known
-        const auto serviceName = to_string(serviceDescriptor);
-        if (announcementMap.count(serviceName) > 0)
+        const auto insertResult = announcementMap.emplace(serviceDescriptor.GetServiceId(), serviceDescriptor);
+        if (!insertResult.second)
         {
             continue;
         }
-        else
-        {
-            _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
-            // Store by service name
-            announcementMap[serviceName] = serviceDescriptor;
-            CallHandlers(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
-        }
+
+        _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
+        CallHandlers(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
     }
 }
 
@@ -92,7 +88,7 @@ void ServiceDiscovery::OnParticpantRemoval(const std::string& participantName)
 
     // Locally announce removal of all services from the leaving participant
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
-    auto announcedIt = _servicesByParticipant.find(participantName);
+    auto announcedIt = _servicesByParticipant.find(SilKit::Util::Hash::Hash(participantName));
     if (announcedIt != _servicesByParticipant.end())
     {
         for (const auto& serviceMap : (*announcedIt).second)
@@ -157,11 +153,24 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
 {
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
     auto&& fromParticipant = serviceDescriptor.GetParticipantName();
-    auto&& announcementMap = _servicesByParticipant[fromParticipant];
-    const auto cachedServiceKey = to_string(serviceDescriptor);
-    if (announcementMap.count(cachedServiceKey) > 0)
+    auto&& announcementMap = _servicesByParticipant[serviceDescriptor.GetParticipantId()];
+    auto knownService = announcementMap.find(serviceDescriptor.GetServiceId());
+    if (knownService != announcementMap.end())
     {
         //we already now this participant's service
+        if (knownService->second.GetSupplementalData() == serviceDescriptor.GetSupplementalData())
+        {
+            return;
+        }
+
+        // A known service announced with changed supplemental data (e.g., the acceptance filters of a CAN controller)
+        // replaces the cached descriptor. It is announced as created again, which older participants ignore, but only
+        // the update handlers are notified.
+        knownService->second = serviceDescriptor;
+        for (auto&& handler : _updateHandlers)
+        {
+            handler(serviceDescriptor);
+        }
         return;
     }
 
@@ -180,7 +189,7 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
     }
 
     // Update the cache
-    announcementMap[cachedServiceKey] = serviceDescriptor;
+    announcementMap[serviceDescriptor.GetServiceId()] = serviceDescriptor;
 
     _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
     CallHandlers(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
@@ -190,8 +199,9 @@ void ServiceDiscovery::AnnounceLocalParticipantTo(const std::string& otherPartic
 {
     ParticipantDiscoveryEvent localServices;
     localServices.participantName = _participantName;
-    localServices.services.reserve(_servicesByParticipant[_participantName].size());
-    for (const auto& thisParticipantServiceMap : _servicesByParticipant[_participantName])
+    const auto& localServiceMap = _servicesByParticipant[_participantId];
+    localServices.services.reserve(localServiceMap.size());
+    for (const auto& thisParticipantServiceMap : localServiceMap)
     {
         localServices.services.push_back(thisParticipantServiceMap.second);
     }
@@ -201,9 +211,8 @@ void ServiceDiscovery::AnnounceLocalParticipantTo(const std::string& otherPartic
 void ServiceDiscovery::OnServiceRemoval(const ServiceDescriptor& serviceDescriptor)
 {
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
-    auto&& fromParticipant = serviceDescriptor.GetParticipantName();
-    auto&& announcementMap = _servicesByParticipant[fromParticipant];
-    auto numErased = announcementMap.erase(to_string(serviceDescriptor));
+    auto&& announcementMap = _servicesByParticipant[serviceDescriptor.GetParticipantId()];
+    auto numErased = announcementMap.erase(serviceDescriptor.GetServiceId());
     if (numErased == 0)
     {
         //we only notify once per event
@@ -258,8 +267,18 @@ void ServiceDiscovery::RegisterServiceDiscoveryHandler(ServiceDiscoveryHandler h
     _handlers.emplace_back(std::move(handler));
 }
 
+void ServiceDiscovery::RegisterServiceUpdateHandler(ServiceUpdateHandler handler)
+{
+    if (_shuttingDown)
+    {
+        return;
+    }
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+    _updateHandlers.emplace_back(std::move(handler));
+}
+
 void ServiceDiscovery::RegisterSpecificServiceDiscoveryHandler(
-    ServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& topic,
+    SpecificServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& topic,
     const std::vector<SilKit::Services::MatchingLabel>& labels)
 {
     if (_shuttingDown)
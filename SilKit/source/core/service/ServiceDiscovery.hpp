@@ -58,8 +58,10 @@ public: //IServiceDiscovery
     void NotifyServiceRemoved(const ServiceDescriptor& serviceDescriptor) override;
     //!< Register a handler for asynchronous service creation notifications
     void RegisterServiceDiscoveryHandler(ServiceDiscoveryHandler handler) override;
+    //!< Register a handler for known services which are announced again with changed supplemental data
+    void RegisterServiceUpdateHandler(ServiceUpdateHandler handler) override;
     //!< Register a specific handler for asynchronous service creation notifications
-    void RegisterSpecificServiceDiscoveryHandler(ServiceDiscoveryHandler handler, const std::string& controllerType,
+    void RegisterSpecificServiceDiscoveryHandler(SpecificServiceDiscoveryHandler handler, const std::string& controllerType,
                                                  const std::string& topic,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels) override;
 
@@ -97,11 +99,13 @@ private: // Methods
 private:
     IParticipantInternal* _participant{nullptr};
     std::string _participantName;
+    ParticipantId _participantId{0};
     ServiceDescriptor _serviceDescriptor; //!< for the ServiceDiscovery controller itself
     std::vector<ServiceDiscoveryHandler> _handlers;
-    //!< a cache for computing additions/removals per participant
-    using ServiceMap = std::unordered_map<std::string /*serviceDescriptor*/, ServiceDescriptor>;
-    std::unordered_map<std::string /* participant name */, ServiceMap> _servicesByParticipant; 
+    std::vector<ServiceUpdateHandler> _updateHandlers;
+    //!< a cache for computing additions/removals per participant, services are unique by their id within a participant
+    using ServiceMap = std::unordered_map<EndpointId /* service id */, ServiceDescriptor>;
+    std::unordered_map<ParticipantId, ServiceMap> _servicesByParticipant;
     SpecificDiscoveryStore _specificDiscoveryStore;
     mutable std::recursive_mutex _discoveryMx;
     std::atomic<bool> _shuttingDown{false};
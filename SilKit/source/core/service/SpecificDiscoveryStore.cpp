@@ -20,7 +20,7 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SpecificDiscoveryStore.hpp"
-#include "YamlParser.hpp"
+#include "MatchingLabels.hpp"
 namespace {
 inline auto MakeFilter(const std::string& type, const std::string& topicOrFunction) 
   -> SilKit::Core::Discovery::FilterType
@@ -42,39 +42,35 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
         if (_allowedControllers.count(supplControllerTypeName))
         {
             std::string key;
-            std::string mediaType;
-            std::vector<SilKit::Services::MatchingLabel> labels;
+            std::string labelsKey;
 
             // extract relevant information depending on controllerType
             if (supplControllerTypeName == controllerTypeRpcServerInternal)
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcServerInternalClientUUID, key);
-                serviceDescriptor.GetSupplementalDataItem(supplKeyRpcServerMediaType, mediaType);
             }
             else if (supplControllerTypeName == controllerTypeRpcClient)
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientFunctionName, key);
-                serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientMediaType, mediaType);
-
-                // Add labels
-                std::string labelsStr;
-                if(serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientLabels, labelsStr))
-                {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-                }
+                labelsKey = supplKeyRpcClientLabels;
             }
             else if (supplControllerTypeName == controllerTypeDataPublisher)
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherTopic, key);
-                serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherMediaType, mediaType);
+                labelsKey = supplKeyDataPublisherPubLabels;
+            }
 
-                // Add labels
-                std::string labelsStr;
-                if(serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-                {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-                }
+            // The labels are parsed when a service is seen for the first time and are kept until it is removed
+            auto& entry = _lookup[MakeFilter(supplControllerTypeName, key)];
+            const auto endpointAddress = serviceDescriptor.to_endpointAddress();
+            auto labelsIt = entry.nodeLabels.find(endpointAddress);
+            if (labelsIt == entry.nodeLabels.end())
+            {
+                auto labels = labelsKey.empty() ? std::vector<SilKit::Services::MatchingLabel>{}
+                                                : ParseMatchingLabels(serviceDescriptor, labelsKey);
+                labelsIt = entry.nodeLabels.emplace(endpointAddress, std::move(labels)).first;
             }
+            const auto& labels = labelsIt->second;
 
             CallHandlersOnServiceChange(changeType, supplControllerTypeName, key, labels, serviceDescriptor);
             if (changeType == ServiceDiscoveryEvent::Type::ServiceCreated)
@@ -84,13 +80,14 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
             else if (changeType == ServiceDiscoveryEvent::Type::ServiceRemoved)
             {
                 RemoveLookupNode(supplControllerTypeName, key, serviceDescriptor);
+                entry.nodeLabels.erase(labelsIt);
             }
         }
     }
 }
 
 // A new subscriber shows up -> notify of all earlier services
-void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(const ServiceDiscoveryHandler& handler,
+void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(const SpecificServiceDiscoveryHandler& handler,
                                                               const std::string& controllerType_, const std::string& key,
                                                               const std::vector<SilKit::Services::MatchingLabel>& labels)
 {
@@ -99,12 +96,16 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(const ServiceDisco
 
     auto* greedyLabel = GetLabelWithMinimalNodeSet(entry, labels);
 
+    const auto labelsOf = [&entry](const ServiceDescriptor& serviceDescriptor) -> const auto& {
+        return entry.nodeLabels.at(serviceDescriptor.to_endpointAddress());
+    };
+
     if (greedyLabel == nullptr)
     {
         // no labels present trigger all
         for (auto&& serviceDescriptor : entry.allCluster.nodes)
         {
-            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
+            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor, labelsOf(serviceDescriptor));
         }
     }
     else
@@ -114,17 +115,17 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(const ServiceDisco
             // trigger notlabel handlers
             for (auto&& serviceDescriptor : entry.notLabelMap[greedyLabel->key].nodes)
             {
-                handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
+                handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor, labelsOf(serviceDescriptor));
             }
             for (auto&& serviceDescriptor : entry.noLabelCluster.nodes)
             {
-                handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
+                handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor, labelsOf(serviceDescriptor));
             }
         }
         // trigger label handlers
         for (auto&& serviceDescriptor : entry.labelMap[MakeFilter(greedyLabel->key, greedyLabel->value)].nodes)
         {
-            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
+            handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor, labelsOf(serviceDescriptor));
         }
     }
 }
@@ -147,7 +148,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
         {
             if (handler)
             {
-                (*handler)(eventType, serviceDescriptor);
+                (*handler)(eventType, serviceDescriptor, labels);
             }
         }
     }
@@ -160,14 +161,14 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
             {
                 if (handler)
                 {
-                    (*handler)(eventType, serviceDescriptor);
+                    (*handler)(eventType, serviceDescriptor, labels);
                 }
             }
             for (auto&& handler : entry.noLabelCluster.handlers)
             {
                 if (handler)
                 {
-                    (*handler)(eventType, serviceDescriptor);
+                    (*handler)(eventType, serviceDescriptor, labels);
                 }
             }
         }
@@ -176,7 +177,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
         {
             if (handler)
             {
-                (*handler)(eventType, serviceDescriptor);
+                (*handler)(eventType, serviceDescriptor, labels);
             }
         }
     }
@@ -373,7 +374,7 @@ void SpecificDiscoveryStore::RemoveLookupNode(const std::string& controllerType_
 
 void SpecificDiscoveryStore::InsertLookupHandler(const std::string& controllerType_, const std::string& key,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels,
-                                                ServiceDiscoveryHandler handler)
+                                                SpecificServiceDiscoveryHandler handler)
 {
     auto handlerPtr = std::make_shared<decltype(handler)>(std::move(handler));
     UpdateDiscoveryClusters(controllerType_, key, labels, [handlerPtr](auto& cluster) {
@@ -382,7 +383,7 @@ void SpecificDiscoveryStore::InsertLookupHandler(const std::string& controllerTy
 }
 
 void SpecificDiscoveryStore::RegisterSpecificServiceDiscoveryHandler(
-    ServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& key, 
+    SpecificServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& key, 
     const std::vector<SilKit::Services::MatchingLabel>& labels)
 {
     CallHandlerOnHandlerRegistration(handler, controllerType_, key, labels);
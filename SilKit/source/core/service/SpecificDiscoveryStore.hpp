@@ -50,7 +50,7 @@ struct FilterTypeHash
     }
 };
 
-using HandlerValue = std::shared_ptr<ServiceDiscoveryHandler>;
+using HandlerValue = std::shared_ptr<SpecificServiceDiscoveryHandler>;
 
 //! Stores all potential nodes (service descriptors) and handlers to call for a specific data matching branch
 class DiscoveryCluster
@@ -72,6 +72,8 @@ public:
     DiscoveryCluster noLabelCluster;
     //!< Stores all handlers/nodes for a controllerType and key
     DiscoveryCluster allCluster;
+    //!< Stores the matching labels of all nodes, parsed once when the node is created
+    std::map<EndpointAddress, std::vector<SilKit::Services::MatchingLabel>> nodeLabels;
 };
 
 //! Store to prevent quadratic lookup of services
@@ -95,7 +97,7 @@ public:
     *   Note: handler might be called for service discovery events that only if a subset of the parameter constraints
     *   Implementation is not thread safe, all public API interactions must be secured with a common mutex
     */ 
-    void RegisterSpecificServiceDiscoveryHandler(ServiceDiscoveryHandler handler, const std::string& controllerType,
+    void RegisterSpecificServiceDiscoveryHandler(SpecificServiceDiscoveryHandler handler, const std::string& controllerType,
                                                  const std::string& key,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels);
 
@@ -107,7 +109,7 @@ private: //methods
                                      const ServiceDescriptor& serviceDescriptor);
 
     //!< Trigger handler for past events that happened before registration
-    void CallHandlerOnHandlerRegistration(const ServiceDiscoveryHandler& handler, const std::string& controllerType,
+    void CallHandlerOnHandlerRegistration(const SpecificServiceDiscoveryHandler& handler, const std::string& controllerType,
                                           const std::string& topic,
                                           const std::vector<SilKit::Services::MatchingLabel>& labels);
 
@@ -144,7 +146,7 @@ private: //methods
     //!< Insert a new lookup handler
     void InsertLookupHandler(const std::string& controllerType, const std::string& key, 
                           const std::vector<SilKit::Services::MatchingLabel>& labels,
-                             ServiceDiscoveryHandler handler);
+                             SpecificServiceDiscoveryHandler handler);
 
 private: //member
 
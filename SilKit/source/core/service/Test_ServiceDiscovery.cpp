@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <functional>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -155,10 +156,11 @@ TEST_F(Test_ServiceDiscovery, multiple_service_creation_notification)
 
     ServiceDiscoveryEvent event;
 
-    auto sendAnnounce = [&](auto&& serviceName) {
+    auto sendAnnounce = [&](auto&& serviceName, EndpointId serviceId) {
         ServiceDescriptor descr;
         descr = senderDescriptor;
         descr.SetServiceName(serviceName);
+        descr.SetServiceId(serviceId);
         // Ensure we only append new services
         event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
         event.serviceDescriptor = descr;
@@ -176,7 +178,7 @@ TEST_F(Test_ServiceDiscovery, multiple_service_creation_notification)
 
     for (auto i = 0; i < 10; i++)
     {
-        sendAnnounce("Service" + std::to_string(i));
+        sendAnnounce("Service" + std::to_string(i), static_cast<EndpointId>(i));
     }
 }
 
@@ -211,8 +213,9 @@ TEST_F(Test_ServiceDiscovery, service_removal)
     ).Times(0);
     disco.ReceiveMsg(&otherParticipant, event);
 
-    // add a modified one
+    // add a modified one, services are identified by their id
     event.serviceDescriptor.SetServiceName("Modified");
+    event.serviceDescriptor.SetServiceId(1);
     auto modifiedDescr = event.serviceDescriptor;
     EXPECT_CALL(callbacks,
         ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, modifiedDescr)
@@ -235,4 +238,59 @@ TEST_F(Test_ServiceDiscovery, service_removal)
     ).Times(0);
     disco.ReceiveMsg(&otherParticipant, event);
 }
+
+TEST_F(Test_ServiceDiscovery, service_update_with_changed_supplemental_data)
+{
+    MockServiceEndpoint otherParticipant{ "P1", "N1", "C1", 2 };
+    ServiceDiscovery disco{ &participant, "ParticipantA" };
+
+    disco.RegisterServiceDiscoveryHandler([this](auto type, auto&& descr) {
+        callbacks.ServiceDiscoveryHandler(type, descr);
+    });
+
+    std::vector<ServiceDescriptor> updates;
+    disco.RegisterServiceUpdateHandler([&updates](auto&& descr) {
+        updates.push_back(descr);
+    });
+
+    ServiceDescriptor descr;
+    descr.SetParticipantNameAndComputeId("ParticipantB");
+    descr.SetNetworkName("Link1");
+    descr.SetServiceName("TestService");
+    descr.SetSupplementalDataItem("Key", "A");
+
+    ServiceDiscoveryEvent event;
+    event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
+    event.serviceDescriptor = descr;
+
+    auto updatedDescr = descr;
+    updatedDescr.SetSupplementalDataItem("Key", "B");
+
+    // the service is reported as created once, the update only reaches the update handlers
+    EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, _))
+        .WillOnce(Invoke([](auto, const ServiceDescriptor& notified) {
+            std::string value;
+            EXPECT_TRUE(notified.GetSupplementalDataItem("Key", value));
+            EXPECT_EQ(value, "A");
+        }));
+    EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceRemoved, _)).Times(0);
+
+    disco.ReceiveMsg(&otherParticipant, event);
+    EXPECT_TRUE(updates.empty());
+
+    // the same service with changed supplemental data is an update, which is not repeated
+    event.serviceDescriptor = updatedDescr;
+    disco.ReceiveMsg(&otherParticipant, event);
+    disco.ReceiveMsg(&otherParticipant, event);
+
+    ASSERT_EQ(updates.size(), 1u);
+    std::string updatedValue;
+    EXPECT_TRUE(updates[0].GetSupplementalDataItem("Key", updatedValue));
+    EXPECT_EQ(updatedValue, "B");
+
+    // the cache holds the updated descriptor
+    const auto services = disco.GetServices();
+    ASSERT_EQ(services.size(), 1u);
+    EXPECT_EQ(services[0].GetSupplementalData(), updatedDescr.GetSupplementalData());
+}
 } // anonymous namespace for test
@@ -273,7 +273,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_handler_then_service_discovery)
     noLabelTestDescriptor.SetServiceId(1);
 
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
+        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+               const std::vector<SilKit::Services::MatchingLabel>& /*labels*/) {
             callbacks.ServiceDiscoveryHandler(discoveryType, sd);
         },
         controllerTypeDataPublisher, "Topic1", {});
@@ -303,7 +304,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_no_lab
     EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, noLabelTestDescriptor))
         .Times(1);
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
+        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+               const std::vector<SilKit::Services::MatchingLabel>& /*labels*/) {
             callbacks.ServiceDiscoveryHandler(discoveryType, sd);
         },
         controllerTypeDataPublisher, "Topic1", {});
@@ -332,7 +334,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_labels
         .Times(1);
 
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
+        [this](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+               const std::vector<SilKit::Services::MatchingLabel>& /*labels*/) {
             callbacks.ServiceDiscoveryHandler(discoveryType, sd);
         },
         controllerTypeDataPublisher, "Topic1", {label});
@@ -374,13 +377,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
         {"kC", "vC", SilKit::Services::MatchingLabel::Kind::Optional}};
 
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this, optionalSubscriberLabels](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
-            std::vector<SilKit::Services::MatchingLabel> labels;
-            std::string labelsStr;
-            if (sd.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-            {
-                labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-            }
+        [this, optionalSubscriberLabels](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+                                         const std::vector<SilKit::Services::MatchingLabel>& labels) {
             if (MatchLabels(labels, optionalSubscriberLabels))
             {
                 callbacks.ServiceDiscoveryHandler(discoveryType, sd);
@@ -393,13 +391,8 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
     {"kB", "vB", SilKit::Services::MatchingLabel::Kind::Optional},
     {"kC", "vC", SilKit::Services::MatchingLabel::Kind::Optional}};
     testStore.RegisterSpecificServiceDiscoveryHandler(
-        [this, optionalSubscriberLabels2](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd) {
-            std::vector<SilKit::Services::MatchingLabel> labels;
-            std::string labelsStr;
-            if (sd.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-            {
-                labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-            }
+        [this, optionalSubscriberLabels2](ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& sd,
+                                         const std::vector<SilKit::Services::MatchingLabel>& labels) {
             if (MatchLabels(labels, optionalSubscriberLabels2))
             {
                 callbacks.ServiceDiscoveryHandler(discoveryType, sd);
@@ -408,4 +401,57 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
         controllerTypeDataPublisher, "Topic1", optionalSubscriberLabels2);
 }
 
+TEST_F(Test_SpecificDiscoveryStore, labels_are_parsed_once_and_passed_to_the_handlers_sorted_by_key)
+{
+    using SilKit::Services::MatchingLabel;
+
+    TestWrapperSpecificDiscoveryStore testStore;
+
+    const std::vector<MatchingLabel> publisherLabels{{"kB", "vB", MatchingLabel::Kind::Mandatory},
+                                                     {"kA", "vA", MatchingLabel::Kind::Mandatory}};
+    const auto isSortedPublisherLabels =
+        ElementsAre(AllOf(Field(&MatchingLabel::key, "kA"), Field(&MatchingLabel::value, "vA")),
+                    AllOf(Field(&MatchingLabel::key, "kB"), Field(&MatchingLabel::value, "vB")));
+
+    ServiceDescriptor labelTestDescriptor{};
+    labelTestDescriptor.SetParticipantNameAndComputeId("ParticipantA");
+    labelTestDescriptor.SetNetworkName("Link1");
+    labelTestDescriptor.SetServiceName("ServiceDiscovery");
+    labelTestDescriptor.SetServiceId(1);
+    labelTestDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType, controllerTypeDataPublisher);
+    labelTestDescriptor.SetSupplementalDataItem(supplKeyDataPublisherTopic, "Topic1");
+    labelTestDescriptor.SetSupplementalDataItem(supplKeyDataPublisherMediaType, "text/json");
+    labelTestDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabels,
+                                                SilKit::Config::Serialize(publisherLabels));
+
+    // the handlers carry the same mandatory labels as the publisher, so both are notified of every change
+    std::vector<std::vector<MatchingLabel>> receivedLabels;
+    const auto handler = [&receivedLabels](ServiceDiscoveryEvent::Type /*discoveryType*/,
+                                           const ServiceDescriptor& /*sd*/,
+                                           const std::vector<MatchingLabel>& labels) {
+        receivedLabels.push_back(labels);
+    };
+
+    testStore.RegisterSpecificServiceDiscoveryHandler(handler, controllerTypeDataPublisher, "Topic1",
+                                                      publisherLabels);
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, labelTestDescriptor);
+
+    // the parsed labels are kept with the node and handed to handlers registered later on
+    auto& entry = testStore.GetLookup()[std::make_tuple(controllerTypeDataPublisher, "Topic1")];
+    ASSERT_EQ(entry.nodeLabels.size(), 1u);
+    EXPECT_THAT(entry.nodeLabels.begin()->second, isSortedPublisherLabels);
+    testStore.RegisterSpecificServiceDiscoveryHandler(handler, controllerTypeDataPublisher, "Topic1",
+                                                      publisherLabels);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, labelTestDescriptor);
+    EXPECT_TRUE(entry.nodeLabels.empty());
+
+    // created and registration for both handlers, removed for both handlers
+    ASSERT_EQ(receivedLabels.size(), 4u);
+    for (const auto& labels : receivedLabels)
+    {
+        EXPECT_THAT(labels, isSortedPublisherLabels);
+    }
+}
+
 } // anonymous namespace for test
@@ -30,11 +30,13 @@ namespace VSilKit {
 
 
 ConnectPeer::ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILogger* logger,
-                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets)
+                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets,
+                         bool enableSharedMemory)
     : _ioContext{ioContext}
     , _logger{logger}
     , _peerInfo{peerInfo}
     , _enableDomainSockets{enableDomainSockets}
+    , _enableSharedMemory{enableSharedMemory}
 {
     SILKIT_ASSERT(_ioContext != nullptr);
     SILKIT_ASSERT(!_peerInfo.participantName.empty());
@@ -137,11 +139,13 @@ void ConnectPeer::UpdateUris()
         }
     }
 
-    // ensure local-domain URIs are tried first
+    // ensure shared-memory and local-domain URIs are tried first
     std::stable_sort(acceptorUris.begin(), acceptorUris.end(), [](const Uri& lhs, const Uri& rhs) {
         const auto ComputePenalty{[](const Uri& uri) -> int {
             switch (uri.Type())
             {
+            case Uri::UriType::SharedMemory:
+                return 50;
             case Uri::UriType::Local:
                 return 100;
             case Uri::UriType::Tcp:
@@ -217,6 +221,17 @@ void ConnectPeer::TryNextUri()
             }
             break;
 
+        case Uri::UriType::SharedMemory:
+            if (!_enableSharedMemory)
+            {
+                Log::Debug(_logger, "Unable to connect via shared memory because it is disabled via configuration");
+            }
+            else
+            {
+                _connector = _ioContext->MakeSharedMemoryConnector(uri.Path());
+            }
+            break;
+
         default:
             Log::Warn(_logger, "Invalid uri type {}", static_cast<std::underlying_type_t<Uri::UriType>>(uri.Type()));
             break;
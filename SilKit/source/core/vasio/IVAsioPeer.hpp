@@ -57,6 +57,8 @@ public:
     //! Version management for backward compatibility on network ser/des level
     virtual void SetProtocolVersion(ProtocolVersion v) = 0;
     virtual auto GetProtocolVersion() const -> ProtocolVersion = 0;
+    //! Messages of at least this size are compressed when sent to the peer, zero if they are never compressed
+    virtual auto GetCompressionThreshold() const -> size_t = 0;
 };
 
 
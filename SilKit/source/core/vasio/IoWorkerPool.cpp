@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "IoWorkerPool.hpp"
+
+#include "ILogger.hpp"
+#include "SetThreadName.hpp"
+
+#include <algorithm>
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+namespace VSilKit {
+
+
+IoWorkerPool::IoWorkerPool(size_t numberOfWorkers, const std::string& threadName,
+                           SilKit::Services::Logging::ILogger* logger)
+    : _logger{logger}
+{
+    numberOfWorkers = std::max<size_t>(numberOfWorkers, 1);
+
+    for (size_t index = 0; index != numberOfWorkers; ++index)
+    {
+        _workers.emplace_back(std::make_unique<Worker>());
+    }
+
+    for (size_t index = 0; index != numberOfWorkers; ++index)
+    {
+        auto& worker{*_workers[index]};
+
+        worker.thread = std::thread{[this, &worker, name = threadName + std::to_string(index)] {
+            SilKit::Util::SetThreadName(name.substr(0, 15));
+            RunWorker(worker);
+        }};
+    }
+}
+
+
+IoWorkerPool::~IoWorkerPool()
+{
+    Stop();
+}
+
+
+auto IoWorkerPool::GetNumberOfWorkers() const -> size_t
+{
+    return _workers.size();
+}
+
+
+void IoWorkerPool::Post(size_t workerIndex, std::function<void()> function)
+{
+    auto& worker{*_workers[workerIndex % _workers.size()]};
+
+    {
+        std::lock_guard<decltype(worker.mutex)> lock{worker.mutex};
+
+        if (worker.stopping)
+        {
+            return;
+        }
+
+        worker.queue.emplace_back(std::move(function));
+    }
+
+    worker.condition.notify_one();
+}
+
+
+void IoWorkerPool::Stop()
+{
+    for (const auto& worker : _workers)
+    {
+        {
+            std::lock_guard<decltype(worker->mutex)> lock{worker->mutex};
+            worker->stopping = true;
+        }
+
+        worker->condition.notify_one();
+    }
+
+    for (const auto& worker : _workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+
+void IoWorkerPool::RunWorker(Worker& worker)
+{
+    std::unique_lock<decltype(worker.mutex)> lock{worker.mutex};
+
+    while (true)
+    {
+        worker.condition.wait(lock, [&worker] {
+            return worker.stopping || !worker.queue.empty();
+        });
+
+        if (worker.queue.empty())
+        {
+            // stopping and all queued functions have been executed
+            return;
+        }
+
+        auto function{std::move(worker.queue.front())};
+        worker.queue.pop_front();
+
+        lock.unlock();
+
+        try
+        {
+            function();
+        }
+        catch (const std::exception& error)
+        {
+            Log::Error(_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
+        }
+        catch (...)
+        {
+            Log::Error(_logger, "SilKit-IOWorker: Something went wrong: unknown exception");
+        }
+
+        lock.lock();
+    }
+}
+
+
+} // namespace VSilKit
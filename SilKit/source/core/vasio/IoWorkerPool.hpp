@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "silkit/services/logging/ILogger.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+/// Fixed number of worker threads, each executing the functions posted to it in FIFO order.
+///
+/// Posting all functions which belong to the same source (e.g., the same peer) to the same worker keeps their relative
+/// order, similar to a strand, while functions of different sources are executed concurrently.
+class IoWorkerPool
+{
+    struct Worker
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::function<void()>> queue;
+        bool stopping{false};
+        std::thread thread;
+    };
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+public:
+    IoWorkerPool(size_t numberOfWorkers, const std::string& threadName, SilKit::Services::Logging::ILogger* logger);
+    ~IoWorkerPool();
+
+    auto GetNumberOfWorkers() const -> size_t;
+
+    /// Enqueue the function to the worker with the given index (modulo the number of workers).
+    void Post(size_t workerIndex, std::function<void()> function);
+
+    /// Execute all functions which are already queued and join the worker threads. Functions posted afterwards are
+    /// discarded.
+    void Stop();
+
+private:
+    void RunWorker(Worker& worker);
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IoWorkerPool;
+} // namespace Core
+} // namespace SilKit
@@ -21,6 +21,32 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SerializedMessage.hpp"
 
+#include <algorithm>
+
+#include "LzCompression.hpp"
+
+namespace {
+
+// The kind SilKitCompressedMsg and the uncompressed body size, which precede the network headers of a compressed message
+constexpr size_t COMPRESSED_BODY_PREFIX_SIZE{sizeof(uint8_t) + sizeof(uint32_t)};
+
+auto CompressIfSmaller(SilKit::Util::Span<const uint8_t> body) -> std::shared_ptr<const std::vector<uint8_t>>
+{
+    auto compressedBody = SilKit::Util::LzCompress(body);
+    if (compressedBody.size() + COMPRESSED_BODY_PREFIX_SIZE >= body.size())
+    {
+        return nullptr;
+    }
+    return std::make_shared<const std::vector<uint8_t>>(std::move(compressedBody));
+}
+
+void CompressOnce(SilKit::Core::CompressedMessageBody& compressed, const std::vector<uint8_t>& body)
+{
+    std::call_once(compressed.once, [&compressed, &body] { compressed.data = CompressIfSmaller(body); });
+}
+
+} // namespace
+
 namespace SilKit {
 namespace Core {
 
@@ -31,16 +57,165 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     ReadNetworkHeaders();
 }
 
+SerializedMessage::SerializedMessage(const SharedMessageBody& body, EndpointAddress endpointAddress,
+                                     EndpointId remoteIndex)
+    : _messageKind{body.messageKind}
+    , _endpointAddress{endpointAddress}
+    , _remoteIndex{remoteIndex}
+    , _sharedBody{body.data}
+    , _compressedBody{body.compressed}
+{
+    if (!IsMwOrSim(_messageKind) || _sharedBody == nullptr)
+    {
+        throw SilKitError{"SerializedMessage: a shared body must contain a valid sim message"};
+    }
+
+    WriteNetworkHeaders(_buffer);
+}
+
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
+{
+    auto storage = ReleaseStorageAndSharedBody();
+    if (_headerOffset != 0)
+    {
+        storage.first.erase(storage.first.begin(), storage.first.begin() + static_cast<std::ptrdiff_t>(_headerOffset));
+    }
+    if (storage.second)
+    {
+        storage.first.insert(storage.first.end(), storage.second->begin(), storage.second->end());
+    }
+    return std::move(storage.first);
+}
+
+auto SerializedMessage::ReleaseStorageAndSharedBody()
+    -> std::pair<std::vector<uint8_t>, std::shared_ptr<const std::vector<uint8_t>>>
 {
     auto buffer = _buffer.ReleaseStorage();
-    if (buffer.size() > std::numeric_limits<uint32_t>::max())
+    auto sharedBody = std::move(_sharedBody);
+
+    const auto messageSize = buffer.size() - _headerOffset + (sharedBody ? sharedBody->size() : 0u);
+    if (messageSize > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
 
-    // emplace the buffer size as the first element in the byte stream
-    const auto bufferSize = static_cast<uint32_t>(buffer.size());
-    memcpy(buffer.data(), &bufferSize, sizeof(uint32_t));
-    return buffer;
+    // emplace the message size as the first element in the byte stream
+    const auto bufferSize = static_cast<uint32_t>(messageSize);
+    memcpy(buffer.data() + _headerOffset, &bufferSize, sizeof(uint32_t));
+    return {std::move(buffer), std::move(sharedBody)};
+}
+
+auto SerializedMessage::GetHeaderOffset() const -> size_t
+{
+    return _headerOffset;
+}
+
+auto SerializedMessage::GetSize() const -> size_t
+{
+    return _buffer.WrittenSize() - _headerOffset + (_sharedBody ? _sharedBody->size() : 0u);
+}
+
+auto SerializedMessage::HasSharedBody() const -> bool
+{
+    return _sharedBody != nullptr;
+}
+
+void SerializedMessage::UseCompactNetworkHeaders()
+{
+    if (!IsMwOrSim(_messageKind) || _hasCompactNetworkHeaders || _hasCompressedBody)
+    {
+        return;
+    }
+
+    auto headerSize = MessageBuffer::MakeSizeCounter();
+    WriteNetworkHeaders(headerSize);
+
+    MessageBuffer compactHeaderBuffer;
+    WriteCompactNetworkHeaders(compactHeaderBuffer);
+    const auto compactHeader = compactHeaderBuffer.ReleaseStorage();
+
+    // The compact headers are never longer than the regular ones. They are written in place, such that they end where
+    // the regular headers end, and the bytes in front of them are skipped when sending. A body which is not shared
+    // stays where it is.
+    const auto version = _buffer.GetProtocolVersion();
+    auto storage = _buffer.ReleaseStorage();
+    _headerOffset = headerSize.WrittenSize() - compactHeader.size();
+    std::copy(compactHeader.begin(), compactHeader.end(), storage.begin() + static_cast<std::ptrdiff_t>(_headerOffset));
+
+    _buffer = MessageBuffer{std::move(storage)};
+    _buffer.SetProtocolVersion(version);
+    _hasCompactNetworkHeaders = true;
+}
+
+auto SerializedMessage::CompressBody() -> bool
+{
+    if (!IsMwOrSim(_messageKind) || _hasCompressedBody)
+    {
+        return false;
+    }
+
+    // compact network headers end where the regular ones end
+    auto headerSize = MessageBuffer::MakeSizeCounter();
+    WriteNetworkHeaders(headerSize);
+    const auto headerEnd = headerSize.WrittenSize();
+
+    const auto storage = _buffer.PeekData();
+
+    size_t bodySize{0};
+    std::shared_ptr<const std::vector<uint8_t>> compressedBody;
+    if (_sharedBody)
+    {
+        bodySize = _sharedBody->size();
+        if (_compressedBody)
+        {
+            CompressOnce(*_compressedBody, *_sharedBody);
+            compressedBody = _compressedBody->data;
+        }
+        else
+        {
+            compressedBody = CompressIfSmaller(*_sharedBody);
+        }
+    }
+    else
+    {
+        bodySize = storage.size() - headerEnd;
+        compressedBody = CompressIfSmaller(Util::Span<const uint8_t>{storage.data() + headerEnd, bodySize});
+    }
+
+    if (compressedBody == nullptr || bodySize > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    // the size placeholder, the prefix of the compressed message, and the network headers without their size
+    const auto* const headersBegin = storage.data() + _headerOffset + sizeof(uint32_t);
+    const auto* const headersEnd = storage.data() + headerEnd;
+    std::vector<uint8_t> headers(sizeof(uint32_t) + COMPRESSED_BODY_PREFIX_SIZE);
+    const auto kind = static_cast<uint8_t>(VAsioMsgKind::SilKitCompressedMsg);
+    const auto uncompressedBodySize = static_cast<uint32_t>(bodySize);
+    memcpy(headers.data() + sizeof(uint32_t), &kind, sizeof(kind));
+    memcpy(headers.data() + sizeof(uint32_t) + sizeof(kind), &uncompressedBodySize, sizeof(uncompressedBodySize));
+    headers.insert(headers.end(), headersBegin, headersEnd);
+
+    const auto version = _buffer.GetProtocolVersion();
+    _buffer = MessageBuffer{std::move(headers)};
+    _buffer.SetProtocolVersion(version);
+    _headerOffset = 0;
+    _sharedBody = std::move(compressedBody);
+    _uncompressedBodySize = uncompressedBodySize;
+    _hasCompressedBody = true;
+    return true;
+}
+
+auto SerializedMessage::DecompressBody() const -> std::vector<uint8_t>
+{
+    if (_sharedBody)
+    {
+        return Util::LzDecompress(*_sharedBody, _uncompressedBodySize);
+    }
+
+    const auto storage = _buffer.PeekData();
+    const auto readPos = std::min(_buffer.ReadPos(), storage.size());
+    return Util::LzDecompress(Util::Span<const uint8_t>{storage.data() + readPos, storage.size() - readPos},
+                              _uncompressedBodySize);
 }
 
 auto SerializedMessage::GetMessageKind() const -> VAsioMsgKind
@@ -88,24 +263,63 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
-void SerializedMessage::WriteNetworkHeaders()
+auto SerializedMessage::PeekProxyMessageRoute() -> ProxyMessageRoute
+{
+    if (_messageKind != VAsioMsgKind::SilKitProxyMessage)
+    {
+        throw SilKitError("SerializedMessage::PeekProxyMessageRoute called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+    return Core::PeekProxyMessageRoute(_buffer);
+}
+
+void SerializedMessage::WriteNetworkHeaders(MessageBuffer& buffer) const
 {
-    _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
-    _buffer << _messageKind;
+    buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
+    buffer << _messageKind;
     if (_messageKind == VAsioMsgKind::SilKitRegistryMessage)
     {
-        _buffer << _registryKind;
+        buffer << _registryKind;
     }
     if (IsMwOrSim(_messageKind))
     {
-        _buffer << _remoteIndex << _endpointAddress;
+        buffer << _remoteIndex << _endpointAddress;
     }
 }
 
+void SerializedMessage::WriteCompactNetworkHeaders(MessageBuffer& buffer) const
+{
+    buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
+    buffer << ToCompactMessageKind(_messageKind);
+    WriteCompactEndpointId(buffer, _remoteIndex);
+    WriteCompactEndpointId(buffer, _endpointAddress.endpoint);
+}
+
 void SerializedMessage::ReadNetworkHeaders()
 {
     _messageSize = ExtractMessageSize(_buffer);
     _messageKind = ExtractMessageKind(_buffer);
+    if (_messageKind == VAsioMsgKind::SilKitCompressedMsg)
+    {
+        // The network headers of the original message follow, only its body is compressed
+        _buffer >> _uncompressedBodySize;
+        _hasCompressedBody = true;
+        _messageKind = ExtractMessageKind(_buffer);
+        if (!IsMwOrSim(_messageKind) && !IsCompactMwOrSim(_messageKind))
+        {
+            throw ProtocolError{"SerializedMessage: a compressed message must contain a sim message"};
+        }
+    }
+    if (IsCompactMwOrSim(_messageKind))
+    {
+        // The participant id of the sender is omitted, the receiver knows it from the connection
+        _messageKind = FromCompactMessageKind(_messageKind);
+        _remoteIndex = ExtractCompactEndpointId(_buffer);
+        _endpointAddress.participant = 0;
+        _endpointAddress.endpoint = ExtractCompactEndpointId(_buffer);
+        _hasCompactNetworkHeaders = true;
+        return;
+    }
     if (_messageKind == VAsioMsgKind::SilKitRegistryMessage)
     {
         //optional registry kind tag
@@ -158,5 +372,13 @@ void SerializedMessage::ReadNetworkHeaders()
     }
 }
 
+void CompressSharedMessageBody(const SharedMessageBody& body)
+{
+    if (body.data && body.compressed)
+    {
+        CompressOnce(*body.compressed, *body.data);
+    }
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -19,6 +19,11 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include "VAsioMsgKind.hpp"
 #include "VAsioDatatypes.hpp"
 #include "SerializedMessageTraits.hpp"
@@ -48,22 +53,41 @@ auto AdlDeserialize(Args&&... args) -> decltype(auto)
 	return Deserialize(std::forward<Args>(args)...);
 }
 
+//! Compute the exact number of bytes the message occupies when serialized with the given protocol version, by running
+//! the same Serialize overloads on a buffer which only counts the written bytes.
 template<typename T>
-struct SerializedSize
+auto SerializedSize(const T& message, ProtocolVersion version = CurrentProtocolVersion()) -> size_t
 {
-    size_t _size{};
-    SerializedSize(const T& message)
-    {
-        MessageBuffer buffer;
-        Serialize(buffer, message);
-        _size = buffer.ReleaseStorage().size();
-    }
-    size_t Size() const
-    {
-        return _size;
-    }
+    auto sizeCounter = MessageBuffer::MakeSizeCounter();
+    sizeCounter.SetProtocolVersion(version);
+    Serialize(sizeCounter, message);
+    return sizeCounter.WrittenSize();
+}
+
+//! The compressed form of a shared message body, computed by the first receiver which compresses it.
+struct CompressedMessageBody
+{
+    std::once_flag once;
+    //! Null if the compression does not make the body smaller
+    std::shared_ptr<const std::vector<uint8_t>> data;
 };
 
+//! A message body which is serialized once and shared by the SerializedMessages of multiple receivers.
+struct SharedMessageBody
+{
+    VAsioMsgKind messageKind{VAsioMsgKind::Invalid};
+    std::shared_ptr<const std::vector<uint8_t>> data;
+    std::shared_ptr<CompressedMessageBody> compressed;
+};
+
+//! Serialize the body of a sim message, which can then be sent to multiple receivers without re-serializing it.
+template<typename MessageT>
+auto MakeSharedMessageBody(const MessageT& message) -> SharedMessageBody;
+
+//! Compress the shared body ahead of sending it, e.g., before taking a lock. Later calls and the receivers which
+//! compress the body reuse the result.
+void CompressSharedMessageBody(const SharedMessageBody& body);
+
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
 {
@@ -81,8 +105,28 @@ public: // Sending a SerializedMessage: from T to binary blob
 	explicit SerializedMessage(const MessageT& message , EndpointAddress endpointAddress, EndpointId remoteIndex);
 	template<typename MessageT>
 	explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+	// Sim messages sharing a pre-serialized body: only the network headers are written
+	explicit SerializedMessage(const SharedMessageBody& body, EndpointAddress endpointAddress, EndpointId remoteIndex);
 
+	//! Return the complete message as a contiguous blob. A shared body is copied.
 	auto ReleaseStorage() -> std::vector<uint8_t>;
+	//! Return the network headers and the shared body (if any) separately, e.g., for gather-writes.
+	auto ReleaseStorageAndSharedBody() -> std::pair<std::vector<uint8_t>, std::shared_ptr<const std::vector<uint8_t>>>;
+	//! Number of bytes at the front of the storage returned by ReleaseStorageAndSharedBody which precede the network
+	//! headers and must not be sent.
+	auto GetHeaderOffset() const -> size_t;
+	auto HasSharedBody() const -> bool;
+	//! Replace the network headers of a sim message by the compact network headers, which encode the remote index
+	//! and the endpoint id as variable-length integers and omit the participant id of the sender. Only for peers with
+	//! the "compact-network-header" capability. Has no effect on other message kinds.
+	void UseCompactNetworkHeaders();
+	//! Replace the body of a sim message by its LZ-compressed form, if this makes the message smaller. The network
+	//! headers stay uncompressed, they are preceded by the kind SilKitCompressedMsg and the uncompressed body size. A
+	//! shared body is compressed only once for all receivers. Must be called after UseCompactNetworkHeaders. Returns
+	//! true if the body was replaced.
+	auto CompressBody() -> bool;
+	//! Number of bytes the message occupies on the wire
+	auto GetSize() const -> size_t;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	explicit SerializedMessage(std::vector<uint8_t>&& blob);
@@ -98,11 +142,17 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	auto GetEndpointAddress() const -> EndpointAddress;
 	void SetProtocolVersion(ProtocolVersion version);
     auto GetProxyMessageHeader() const -> ProxyMessageHeader;
+    //! Read the source and destination of a proxy message, without advancing the read position.
+    auto PeekProxyMessageRoute() -> ProxyMessageRoute;
 	auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
 
 private:
-	void WriteNetworkHeaders();
+	template<typename MessageT>
+	void WriteMessage(const MessageT& message);
+	void WriteNetworkHeaders(MessageBuffer& buffer) const;
+	void WriteCompactNetworkHeaders(MessageBuffer& buffer) const;
 	void ReadNetworkHeaders();
+	auto DecompressBody() const -> std::vector<uint8_t>;
 	// network headers, some members are optional depending on messageKind
 	uint32_t _messageSize{0};
 	VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
@@ -110,12 +160,21 @@ private:
 	// For simMsg
 	EndpointAddress _endpointAddress{};
 	EndpointId _remoteIndex{0};
+	bool _hasCompactNetworkHeaders{false};
+	// Unused bytes in front of the compact network headers, which are written in place of the regular ones
+	size_t _headerOffset{0};
+	// The body is compressed, it is decompressed when the message is deserialized
+	bool _hasCompressedBody{false};
+	uint32_t _uncompressedBodySize{0};
 	// For registry messages
 	RegistryMsgHeader _registryMessageHeader;
     // For proxy messages
     ProxyMessageHeader _proxyMessageHeader;
 
 	MessageBuffer _buffer;
+	// Optional body shared with other SerializedMessages, follows the network headers in _buffer on the wire
+	std::shared_ptr<const std::vector<uint8_t>> _sharedBody;
+	std::shared_ptr<CompressedMessageBody> _compressedBody;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -124,13 +183,9 @@ private:
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -138,14 +193,10 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 template <typename MessageT>
 SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _buffer.SetProtocolVersion(version);
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -153,22 +204,51 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _remoteIndex = remoteIndex;
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+template <typename MessageT>
+void SerializedMessage::WriteMessage(const MessageT& message)
+{
+    // count the bytes first, so that the message is written into a single allocation of the exact size
+    auto sizeCounter = MessageBuffer::MakeSizeCounter();
+    sizeCounter.SetProtocolVersion(_buffer.GetProtocolVersion());
+    WriteNetworkHeaders(sizeCounter);
+    Serialize(sizeCounter, message);
+
+    _buffer.IncreaseCapacity(sizeCounter.WrittenSize());
+    WriteNetworkHeaders(_buffer);
+    Serialize(_buffer, message);
+}
+
+template <typename MessageT>
+auto MakeSharedMessageBody(const MessageT& message) -> SharedMessageBody
+{
+    MessageBuffer buffer;
+    buffer.IncreaseCapacity(SerializedSize(message));
+    Serialize(buffer, message);
+
+    SharedMessageBody body;
+    body.messageKind = messageKind<MessageT>();
+    body.data = std::make_shared<const std::vector<uint8_t>>(buffer.ReleaseStorage());
+    body.compressed = std::make_shared<CompressedMessageBody>();
+    return body;
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
+    if (_sharedBody || _hasCompressedBody)
+    {
+        return static_cast<const SerializedMessage&>(*this).Deserialize<ApiMessageT>();
+    }
+
     ApiMessageT value{};
     AdlDeserialize(_buffer, value);
     return value;
@@ -177,6 +257,24 @@ auto SerializedMessage::Deserialize() -> ApiMessageT
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() const -> ApiMessageT
 {
+    if (_hasCompressedBody)
+    {
+        MessageBuffer body{DecompressBody()};
+        body.SetProtocolVersion(_buffer.GetProtocolVersion());
+        ApiMessageT value{};
+        AdlDeserialize(body, value);
+        return value;
+    }
+
+    if (_sharedBody)
+    {
+        MessageBuffer bodyCopy{_sharedBody};
+        bodyCopy.SetProtocolVersion(_buffer.GetProtocolVersion());
+        ApiMessageT value{};
+        AdlDeserialize(bodyCopy, value);
+        return value;
+    }
+
     auto bufferCopy = _buffer;
     ApiMessageT value{};
     AdlDeserialize(bufferCopy, value);
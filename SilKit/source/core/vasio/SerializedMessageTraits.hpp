@@ -47,6 +47,8 @@ template<>
 inline constexpr auto messageKind<SubscriptionAcknowledge>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAcknowledge; }
 template<>
 inline constexpr auto messageKind<VAsioMsgSubscriber>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAnnouncement; }
+template<>
+inline constexpr auto messageKind<SubscriptionRemoval>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionRemoval; }
 
 // Proxy messages
 template<>
@@ -68,6 +70,10 @@ inline constexpr auto registryMessageKind<RemoteParticipantConnectRequest>() ->
 
 // Helper function to classify simulation messages based on message kind
 inline constexpr bool IsMwOrSim(VAsioMsgKind kind);
+// Helper functions for simulation messages with compact network headers
+inline constexpr bool IsCompactMwOrSim(VAsioMsgKind kind);
+inline constexpr auto ToCompactMessageKind(VAsioMsgKind kind) -> VAsioMsgKind;
+inline constexpr auto FromCompactMessageKind(VAsioMsgKind kind) -> VAsioMsgKind;
 
 //////////////////////////////////////////////////////////////////////
 // Inline Implementations
@@ -79,5 +85,22 @@ inline constexpr bool IsMwOrSim(VAsioMsgKind kind)
         ;
 }
 
+inline constexpr bool IsCompactMwOrSim(VAsioMsgKind kind)
+{
+    return kind == VAsioMsgKind::SilKitCompactMwMsg
+        || kind == VAsioMsgKind::SilKitCompactSimMsg
+        ;
+}
+
+inline constexpr auto ToCompactMessageKind(VAsioMsgKind kind) -> VAsioMsgKind
+{
+    return kind == VAsioMsgKind::SilKitMwMsg ? VAsioMsgKind::SilKitCompactMwMsg : VAsioMsgKind::SilKitCompactSimMsg;
+}
+
+inline constexpr auto FromCompactMessageKind(VAsioMsgKind kind) -> VAsioMsgKind
+{
+    return kind == VAsioMsgKind::SilKitCompactMwMsg ? VAsioMsgKind::SilKitMwMsg : VAsioMsgKind::SilKitSimMsg;
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -30,6 +30,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IMessageReceiver.hpp"
 #include "TimeSyncService.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
 namespace SilKit {
 namespace Core {
 
@@ -37,6 +41,7 @@ template <class MsgT>
 class SilKitLink
 {
 public:
+    using MsgType = MsgT;
     using ReceiverT = IMessageReceiver<MsgT>;
 
 public:
@@ -52,22 +57,34 @@ public:
     inline auto Name() const -> const std::string& { return _name; }
 
     void AddLocalReceiver(ReceiverT* receiver);
+    void RemoveLocalReceiver(ReceiverT* receiver);
     void AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx);
     void RemoveRemoteReceiver(IVAsioPeer* peer);
+    void RemoveRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx);
     size_t GetNumberOfRemoteReceivers();
     std::vector<std::string> GetParticipantNamesOfRemoteReceivers();
 
     void DistributeRemoteSilKitMessage(const IServiceEndpoint* from, MsgT&& msg);
     void DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg);
 
+    // The two halves of DistributeLocalSilKitMessage, remote receivers must be served first.
+    void DistributeLocalSilKitMessageToRemoteReceivers(const IServiceEndpoint* from, const MsgT& msg);
+    void DistributeLocalSilKitMessageToLocalReceivers(const IServiceEndpoint* from, const MsgT& msg);
+    auto HasLocalReceiversFor(const IServiceEndpoint* from) const -> bool;
+
     void SetHistoryLength(size_t history);
 
+    void AddRemoteService(const ServiceDescriptor& serviceDescriptor);
+    void RemoveRemoteService(const ServiceDescriptor& serviceDescriptor);
+
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg);
 
 private:
     // ----------------------------------------
     // private methods
     void DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg);
+    static auto IsLocalReceiverFor(const ReceiverT* receiver, const IServiceEndpoint* from) -> bool;
+    auto GetLocalReceivers() const -> std::shared_ptr<const std::vector<ReceiverT*>>;
 
 private:
     // ----------------------------------------
@@ -76,7 +93,10 @@ private:
     Services::Logging::ILogger* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
 
-    std::vector<ReceiverT*> _localReceivers;
+    // Local receivers are added on the thread creating a service, while messages are distributed on the threads of the
+    // senders and the IO thread. Readers take a snapshot, which is replaced as a whole when a receiver is added.
+    mutable std::mutex _localReceiversMutex;
+    std::shared_ptr<const std::vector<ReceiverT*>> _localReceivers{std::make_shared<std::vector<ReceiverT*>>()};
     VAsioTransmitter<MsgT> _vasioTransmitter;
 };
 
@@ -94,8 +114,33 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILogger* logge
 template <class MsgT>
 void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
 {
-    if (std::find(_localReceivers.begin(), _localReceivers.end(), receiver) != _localReceivers.end()) return;
-    _localReceivers.push_back(receiver);
+    std::lock_guard<decltype(_localReceiversMutex)> lock{_localReceiversMutex};
+
+    if (std::find(_localReceivers->begin(), _localReceivers->end(), receiver) != _localReceivers->end()) return;
+
+    auto localReceivers = std::make_shared<std::vector<ReceiverT*>>(*_localReceivers);
+    localReceivers->push_back(receiver);
+    _localReceivers = std::move(localReceivers);
+}
+
+template <class MsgT>
+void SilKitLink<MsgT>::RemoveLocalReceiver(ReceiverT* receiver)
+{
+    std::lock_guard<decltype(_localReceiversMutex)> lock{_localReceiversMutex};
+
+    if (std::find(_localReceivers->begin(), _localReceivers->end(), receiver) == _localReceivers->end()) return;
+
+    auto localReceivers = std::make_shared<std::vector<ReceiverT*>>(*_localReceivers);
+    localReceivers->erase(std::remove(localReceivers->begin(), localReceivers->end(), receiver),
+                          localReceivers->end());
+    _localReceivers = std::move(localReceivers);
+}
+
+template <class MsgT>
+auto SilKitLink<MsgT>::GetLocalReceivers() const -> std::shared_ptr<const std::vector<ReceiverT*>>
+{
+    std::lock_guard<decltype(_localReceiversMutex)> lock{_localReceiversMutex};
+    return _localReceivers;
 }
 
 template <class MsgT>
@@ -108,6 +153,12 @@ void SilKitLink<MsgT>::RemoveRemoteReceiver(IVAsioPeer* peer)
 {
     _vasioTransmitter.RemoveRemoteReceiver(peer);
 }
+
+template <class MsgT>
+void SilKitLink<MsgT>::RemoveRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx)
+{
+    _vasioTransmitter.RemoveRemoteReceiver(peer, remoteIdx);
+}
 template <class MsgT>
 auto SilKitLink<MsgT>::GetNumberOfRemoteReceivers() -> size_t
 {
@@ -147,7 +198,8 @@ void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* fro
         SetTimestamp(msg, _timeProvider->Now());
     }
 
-    for (auto&& receiver : _localReceivers)
+    const auto localReceivers = GetLocalReceivers();
+    for (auto&& receiver : *localReceivers)
     {
         DispatchSilKitMessage(receiver, from, msg);
     }
@@ -160,28 +212,63 @@ void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from
     // NB: Messages must be dispatched to remote receivers first.
     // Otherwise, messages that may be produced during the internal dispatch will be dispatched to remote receivers first.
     // As a result, the messages may be delivered in the wrong order (possibly even reversed)
+    DistributeLocalSilKitMessageToRemoteReceivers(from, msg);
+    DistributeLocalSilKitMessageToLocalReceivers(from, msg);
+}
+
+template <class MsgT>
+void SilKitLink<MsgT>::DistributeLocalSilKitMessageToRemoteReceivers(const IServiceEndpoint* from, const MsgT& msg)
+{
     DispatchSilKitMessage(&_vasioTransmitter, from, msg);
-    for (auto&& receiver : _localReceivers)
-    {
-        auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
+}
 
-        // C++ 17 -> if constexpr
-        if (SilKitMsgTraits<MsgT>::IsSelfDeliveryForbidden())
+template <class MsgT>
+void SilKitLink<MsgT>::DistributeLocalSilKitMessageToLocalReceivers(const IServiceEndpoint* from, const MsgT& msg)
+{
+    const auto localReceivers = GetLocalReceivers();
+    for (auto&& receiver : *localReceivers)
+    {
+        if (!IsLocalReceiverFor(receiver, from))
         {
             continue;
         }
-        // C++ 17 -> if constexpr
-        if (!SilKitMsgTraits<MsgT>::IsSelfDeliveryEnforced())
-        {
-            if (receiverId->GetServiceDescriptor() == from->GetServiceDescriptor()) continue;
-        }
+
         // Trace reception of self delivery
-        Services::TraceRx(_logger, receiverId, msg, from->GetServiceDescriptor());
+        Services::TraceRx(_logger, dynamic_cast<const IServiceEndpoint*>(receiver), msg, from->GetServiceDescriptor());
 
         DispatchSilKitMessage(receiver, from, msg);
     }
 }
 
+template <class MsgT>
+auto SilKitLink<MsgT>::HasLocalReceiversFor(const IServiceEndpoint* from) const -> bool
+{
+    const auto localReceivers = GetLocalReceivers();
+    return std::any_of(localReceivers->begin(), localReceivers->end(), [from](const ReceiverT* receiver) {
+        return IsLocalReceiverFor(receiver, from);
+    });
+}
+
+template <class MsgT>
+auto SilKitLink<MsgT>::IsLocalReceiverFor(const ReceiverT* receiver, const IServiceEndpoint* from) -> bool
+{
+    // C++ 17 -> if constexpr
+    if (SilKitMsgTraits<MsgT>::IsSelfDeliveryForbidden())
+    {
+        return false;
+    }
+    // C++ 17 -> if constexpr
+    if (!SilKitMsgTraits<MsgT>::IsSelfDeliveryEnforced())
+    {
+        auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
+        if (receiverId->GetServiceDescriptor() == from->GetServiceDescriptor())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Dispatcher for outgoing SilKitMessages
 template <class MsgT>
 void SilKitLink<MsgT>::DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg)
@@ -212,5 +299,17 @@ void SilKitLink<MsgT>::SetHistoryLength(size_t history)
     _vasioTransmitter.SetHistoryLength(history);
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::AddRemoteService(const ServiceDescriptor& serviceDescriptor)
+{
+    _vasioTransmitter.AddRemoteService(serviceDescriptor);
+}
+
+template <class MsgT>
+void SilKitLink<MsgT>::RemoveRemoteService(const ServiceDescriptor& serviceDescriptor)
+{
+    _vasioTransmitter.RemoveRemoteService(serviceDescriptor);
+}
+
 } // namespace Core
 } // namespace SilKit
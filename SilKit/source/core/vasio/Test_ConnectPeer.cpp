@@ -84,6 +84,7 @@ struct Test_ConnectPeer : ::testing::Test
 TEST_F(Test_ConnectPeer, tcp_hosts_are_resolved_and_tried_in_order_with_specified_timeout)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeConnector{[this] {
@@ -113,7 +114,7 @@ TEST_F(Test_ConnectPeer, tcp_hosts_are_resolved_and_tried_in_order_with_specifie
     peerInfo.acceptorUris.emplace_back("tcp://host:1234");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(1, TIMEOUT);
 
@@ -124,6 +125,7 @@ TEST_F(Test_ConnectPeer, tcp_hosts_are_resolved_and_tried_in_order_with_specifie
 TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeConnector{[this] {
@@ -161,7 +163,49 @@ TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
     peerInfo.acceptorUris.emplace_back("tcp://host:5678");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectPeer, shared_memory_is_tried_before_local_if_enabled)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{true};
+    static constexpr auto TIMEOUT{4321ms};
+
+    auto MakeConnector{[this] {
+        return MakeConnectorThatFails(TIMEOUT);
+    }};
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(ioContext, Resolve("host")).InSequence(s1).WillOnce(Return(std::vector<std::string>{"1.2.3.4"}));
+
+    EXPECT_CALL(ioContext, MakeSharedMemoryConnector("/some/path-shm")).InSequence(s1).WillOnce(MakeConnector);
+    EXPECT_CALL(ioContext, MakeLocalConnector("/some/path")).InSequence(s1).WillOnce(MakeConnector);
+    EXPECT_CALL(ioContext, MakeTcpConnector("1.2.3.4", 1234)).InSequence(s1).WillOnce(MakeConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(0);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(1).InSequence(s1);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("tcp://host:1234");
+    peerInfo.acceptorUris.emplace_back("local:///some/path");
+    peerInfo.acceptorUris.emplace_back("shm:///some/path-shm");
+    peerInfo.capabilities = "";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(1, TIMEOUT);
 
@@ -172,6 +216,7 @@ TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
 TEST_F(Test_ConnectPeer, retry_count_is_honored)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr size_t RETRY_COUNT{3};
     static constexpr auto TIMEOUT{4321ms};
 
@@ -202,7 +247,7 @@ TEST_F(Test_ConnectPeer, retry_count_is_honored)
     peerInfo.acceptorUris.emplace_back("tcp://host:1234");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(RETRY_COUNT, TIMEOUT);
 
@@ -213,6 +258,7 @@ TEST_F(Test_ConnectPeer, retry_count_is_honored)
 TEST_F(Test_ConnectPeer, each_retry_tries_each_uri)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr size_t RETRY_COUNT{2};
     static constexpr auto TIMEOUT{4321ms};
 
@@ -242,7 +288,7 @@ TEST_F(Test_ConnectPeer, each_retry_tries_each_uri)
     peerInfo.acceptorUris.emplace_back("local:///two");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(RETRY_COUNT, TIMEOUT);
 
@@ -253,6 +299,7 @@ TEST_F(Test_ConnectPeer, each_retry_tries_each_uri)
 TEST_F(Test_ConnectPeer, disabling_local_domain_ignores_local_uris)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{false};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeConnector{[this] {
@@ -280,7 +327,7 @@ TEST_F(Test_ConnectPeer, disabling_local_domain_ignores_local_uris)
     peerInfo.acceptorUris.emplace_back("local:///one");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(1, TIMEOUT);
 
@@ -291,6 +338,7 @@ TEST_F(Test_ConnectPeer, disabling_local_domain_ignores_local_uris)
 TEST_F(Test_ConnectPeer, successful_connection_skips_remainder)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{false};
     static constexpr auto TIMEOUT{4321ms};
 
     auto MakeFailingConnector{[this] {
@@ -326,7 +374,7 @@ TEST_F(Test_ConnectPeer, successful_connection_skips_remainder)
     peerInfo.acceptorUris.emplace_back("local:///two");
     peerInfo.capabilities = "";
 
-    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED};
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
     connectPeer.SetListener(connectPeerListener);
     connectPeer.AsyncConnect(2, TIMEOUT);
 
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "IoWorkerPool.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+
+using SilKit::Core::IoWorkerPool;
+
+
+TEST(Test_IoWorkerPool, functions_posted_to_the_same_worker_keep_their_order)
+{
+    static constexpr size_t NUMBER_OF_WORKERS{3};
+    static constexpr int NUMBER_OF_FUNCTIONS{1000};
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> executed(NUMBER_OF_WORKERS);
+
+    {
+        IoWorkerPool pool{NUMBER_OF_WORKERS, "Test", nullptr};
+        ASSERT_EQ(pool.GetNumberOfWorkers(), NUMBER_OF_WORKERS);
+
+        for (int value = 0; value != NUMBER_OF_FUNCTIONS; ++value)
+        {
+            const auto workerIndex = static_cast<size_t>(value) % NUMBER_OF_WORKERS;
+
+            pool.Post(workerIndex, [&mutex, &executed, workerIndex, value] {
+                std::lock_guard<std::mutex> lock{mutex};
+                executed[workerIndex].push_back(value);
+            });
+        }
+
+        // all queued functions are executed before the pool is stopped
+    }
+
+    for (size_t workerIndex = 0; workerIndex != NUMBER_OF_WORKERS; ++workerIndex)
+    {
+        ASSERT_FALSE(executed[workerIndex].empty());
+
+        auto expected = static_cast<int>(workerIndex);
+        for (const auto value : executed[workerIndex])
+        {
+            EXPECT_EQ(value, expected);
+            expected += static_cast<int>(NUMBER_OF_WORKERS);
+        }
+
+        EXPECT_GE(expected, NUMBER_OF_FUNCTIONS);
+    }
+}
+
+TEST(Test_IoWorkerPool, functions_are_executed_on_worker_threads)
+{
+    std::mutex mutex;
+    std::vector<std::thread::id> threadIds;
+
+    {
+        IoWorkerPool pool{2, "Test", nullptr};
+
+        for (size_t workerIndex = 0; workerIndex != 2; ++workerIndex)
+        {
+            pool.Post(workerIndex, [&mutex, &threadIds] {
+                std::lock_guard<std::mutex> lock{mutex};
+                threadIds.push_back(std::this_thread::get_id());
+            });
+        }
+    }
+
+    ASSERT_EQ(threadIds.size(), 2u);
+    EXPECT_NE(threadIds[0], std::this_thread::get_id());
+    EXPECT_NE(threadIds[1], std::this_thread::get_id());
+    EXPECT_NE(threadIds[0], threadIds[1]);
+}
+
+TEST(Test_IoWorkerPool, functions_posted_after_stop_are_discarded)
+{
+    IoWorkerPool pool{1, "Test", nullptr};
+    pool.Stop();
+
+    bool executed{false};
+    pool.Post(0, [&executed] {
+        executed = true;
+    });
+
+    pool.Stop();
+
+    EXPECT_FALSE(executed);
+}
+
+TEST(Test_IoWorkerPool, exceptions_do_not_stop_the_worker)
+{
+    bool executed{false};
+
+    {
+        IoWorkerPool pool{1, "Test", nullptr};
+
+        pool.Post(0, [] {
+            throw std::runtime_error{"failure"};
+        });
+        pool.Post(0, [] {
+            throw 42;
+        });
+        pool.Post(0, [&executed] {
+            executed = true;
+        });
+    }
+
+    EXPECT_TRUE(executed);
+}
+
+
+} // namespace
@@ -21,7 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SerializedMessage.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <array>
 #include <string>
 
@@ -95,3 +97,216 @@ TEST(Test_SerializedMessage, packed_handshake_message)
 
     ASSERT_EQ(to_string(ptr->acceptorUri0, ptr->acceptorUri0Size), announcement.peerInfo.acceptorUris.at(0));
 }
+
+TEST(Test_SerializedMessage, shared_body_matches_individually_serialized_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}};
+
+    EndpointAddress endpointAddress{5678, 42};
+
+    const auto body = MakeSharedMessageBody(event);
+    ASSERT_EQ(body.messageKind, VAsioMsgKind::SilKitMwMsg);
+
+    for (EndpointId remoteIndex : {EndpointId{0}, EndpointId{1}, EndpointId{1000}})
+    {
+        SerializedMessage expected{event, endpointAddress, remoteIndex};
+        SerializedMessage shared{body, endpointAddress, remoteIndex};
+
+        ASSERT_TRUE(shared.HasSharedBody());
+        ASSERT_EQ(shared.GetRemoteIndex(), remoteIndex);
+        ASSERT_EQ(shared.GetEndpointAddress(), endpointAddress);
+
+        const auto deserialized = shared.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        ASSERT_EQ(deserialized.timestamp, event.timestamp);
+        ASSERT_EQ(SilKit::Util::ToStdVector(deserialized.data.AsSpan()), SilKit::Util::ToStdVector(event.data.AsSpan()));
+
+        auto parts = SerializedMessage{body, endpointAddress, remoteIndex}.ReleaseStorageAndSharedBody();
+        ASSERT_EQ(parts.second, body.data);
+
+        const auto expectedBlob = expected.ReleaseStorage();
+        ASSERT_EQ(shared.ReleaseStorage(), expectedBlob);
+
+        auto joined = parts.first;
+        joined.insert(joined.end(), parts.second->begin(), parts.second->end());
+        ASSERT_EQ(joined, expectedBlob);
+    }
+}
+
+TEST(Test_SerializedMessage, deserialized_payload_outlives_received_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}};
+
+    auto blob = SerializedMessage{event, EndpointAddress{5678, 42}, EndpointId{3}}.ReleaseStorage();
+    const auto* const blobBegin = blob.data();
+    const auto* const blobEnd = blob.data() + blob.size();
+
+    SilKit::Services::PubSub::WireDataMessageEvent deserialized;
+    {
+        SerializedMessage received{std::move(blob)};
+        deserialized = received.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+    }
+
+    // the payload refers to the received bytes instead of a copy
+    const auto payload = deserialized.data.AsSpan();
+    ASSERT_GE(payload.data(), blobBegin);
+    ASSERT_LE(payload.data() + payload.size(), blobEnd);
+
+    ASSERT_EQ(deserialized.timestamp, event.timestamp);
+    ASSERT_EQ(SilKit::Util::ToStdVector(payload), SilKit::Util::ToStdVector(event.data.AsSpan()));
+}
+
+TEST(Test_SerializedMessage, serialized_size_is_exact_for_each_message)
+{
+    for (size_t payloadSize : {size_t{0}, size_t{8}, size_t{1500}, size_t{100}})
+    {
+        SilKit::Services::PubSub::WireDataMessageEvent event;
+        event.timestamp = std::chrono::nanoseconds{1234};
+        event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 0xAB)};
+
+        SilKit::Core::MessageBuffer buffer;
+        Serialize(buffer, event);
+        ASSERT_EQ(SerializedSize(event), buffer.ReleaseStorage().size());
+
+        const auto body = MakeSharedMessageBody(event);
+        ASSERT_EQ(SerializedSize(event), body.data->size());
+    }
+}
+
+TEST(Test_SerializedMessage, proxy_message_route_is_peeked_and_relayed_unchanged)
+{
+    ProxyMessage proxyMessage;
+    proxyMessage.source = "Source";
+    proxyMessage.destination = "Destination";
+    proxyMessage.payload = std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8};
+
+    const auto blob = SerializedMessage{proxyMessage}.ReleaseStorage();
+
+    SerializedMessage received{std::vector<uint8_t>{blob}};
+    received.SetProtocolVersion(CurrentProtocolVersion());
+
+    const auto route = received.PeekProxyMessageRoute();
+    ASSERT_EQ(route.header.version, proxyMessage.header.version);
+    ASSERT_EQ(route.source, proxyMessage.source);
+    ASSERT_EQ(route.destination, proxyMessage.destination);
+
+    // peeking the route does not consume the message
+    const auto deserialized = received.Deserialize<ProxyMessage>();
+    ASSERT_EQ(deserialized.source, proxyMessage.source);
+    ASSERT_EQ(deserialized.destination, proxyMessage.destination);
+    ASSERT_EQ(deserialized.payload, proxyMessage.payload);
+
+    // a relayed message is sent as received
+    SerializedMessage relayed{std::vector<uint8_t>{blob}};
+    relayed.SetProtocolVersion(CurrentProtocolVersion());
+    (void)relayed.PeekProxyMessageRoute();
+    ASSERT_EQ(relayed.ReleaseStorage(), blob);
+}
+
+TEST(Test_SerializedMessage, compact_network_headers_are_read_as_regular_headers)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}};
+
+    const EndpointAddress endpointAddress{5678, 42};
+    const EndpointId remoteIndex{3};
+
+    const auto regularBlob = SerializedMessage{event, endpointAddress, remoteIndex}.ReleaseStorage();
+
+    SerializedMessage compact{event, endpointAddress, remoteIndex};
+    compact.UseCompactNetworkHeaders();
+    const auto compactBlob = compact.ReleaseStorage();
+
+    // size, kind, and one byte each for the remote index and the endpoint id
+    ASSERT_EQ(regularBlob.size() - compactBlob.size(), 29u - 7u);
+
+    // a shared body results in the same compact message
+    SerializedMessage shared{MakeSharedMessageBody(event), endpointAddress, remoteIndex};
+    shared.UseCompactNetworkHeaders();
+    ASSERT_EQ(shared.ReleaseStorage(), compactBlob);
+
+    SerializedMessage received{std::vector<uint8_t>{compactBlob}};
+    ASSERT_EQ(received.GetMessageKind(), VAsioMsgKind::SilKitMwMsg);
+    ASSERT_EQ(received.GetRemoteIndex(), remoteIndex);
+    ASSERT_EQ(received.GetEndpointAddress().endpoint, endpointAddress.endpoint);
+
+    const auto deserialized = received.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+    ASSERT_EQ(deserialized.timestamp, event.timestamp);
+    ASSERT_EQ(SilKit::Util::ToStdVector(deserialized.data.AsSpan()), SilKit::Util::ToStdVector(event.data.AsSpan()));
+}
+
+TEST(Test_SerializedMessage, compact_network_headers_do_not_move_the_body)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}};
+
+    const EndpointAddress endpointAddress{5678, 42};
+    const EndpointId remoteIndex{3};
+
+    const auto regularBlob = SerializedMessage{event, endpointAddress, remoteIndex}.ReleaseStorage();
+
+    SerializedMessage compact{event, endpointAddress, remoteIndex};
+    compact.UseCompactNetworkHeaders();
+    const auto parts = compact.ReleaseStorageAndSharedBody();
+
+    // the compact headers are written in front of the body, the storage keeps its size
+    ASSERT_EQ(compact.GetHeaderOffset(), 29u - 7u);
+    ASSERT_EQ(parts.first.size(), regularBlob.size());
+    ASSERT_TRUE(std::equal(regularBlob.begin() + 29, regularBlob.end(), parts.first.begin() + 29));
+
+    uint32_t messageSize{0};
+    memcpy(&messageSize, parts.first.data() + compact.GetHeaderOffset(), sizeof(messageSize));
+    ASSERT_EQ(messageSize, regularBlob.size() - compact.GetHeaderOffset());
+}
+
+TEST(Test_SerializedMessage, compressed_shared_body_is_reused_and_decompressed_on_deserialization)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(1000, 7)};
+
+    const auto body = MakeSharedMessageBody(event);
+
+    SerializedMessage first{body, EndpointAddress{5678, 42}, EndpointId{3}};
+    SerializedMessage second{body, EndpointAddress{5678, 42}, EndpointId{4}};
+    second.UseCompactNetworkHeaders();
+
+    ASSERT_TRUE(first.CompressBody());
+    ASSERT_TRUE(second.CompressBody());
+    ASSERT_LT(first.GetSize(), 1000u);
+
+    // the body is compressed once, both receivers share the result
+    auto firstParts = first.ReleaseStorageAndSharedBody();
+    auto secondParts = second.ReleaseStorageAndSharedBody();
+    ASSERT_EQ(firstParts.second, secondParts.second);
+
+    for (auto* parts : {&firstParts, &secondParts})
+    {
+        auto blob = std::move(parts->first);
+        blob.insert(blob.end(), parts->second->begin(), parts->second->end());
+
+        SerializedMessage received{std::move(blob)};
+        ASSERT_EQ(received.GetMessageKind(), VAsioMsgKind::SilKitMwMsg);
+        ASSERT_EQ(received.GetEndpointAddress().endpoint, 42u);
+
+        const auto deserialized = received.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        ASSERT_EQ(deserialized.timestamp, event.timestamp);
+        ASSERT_EQ(SilKit::Util::ToStdVector(deserialized.data.AsSpan()), std::vector<uint8_t>(1000, 7));
+    }
+}
+
+TEST(Test_SerializedMessage, incompressible_body_is_not_replaced)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}};
+
+    SerializedMessage message{event, EndpointAddress{5678, 42}, EndpointId{3}};
+    const auto size = message.GetSize();
+    ASSERT_FALSE(message.CompressBody());
+    ASSERT_EQ(message.GetSize(), size);
+}
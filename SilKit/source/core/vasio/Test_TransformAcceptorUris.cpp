@@ -168,6 +168,11 @@ struct DummyVAsioPeerBase : IVAsioPeer
         throw MethodNotImplementedError{};
     }
 
+    auto GetCompressionThreshold() const -> size_t final
+    {
+        throw MethodNotImplementedError{};
+    }
+
     // IServiceEndpoint
 
     void SetServiceDescriptor(const ServiceDescriptor&) override
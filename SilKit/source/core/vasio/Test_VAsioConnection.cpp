@@ -67,6 +67,8 @@ using namespace SilKit::Core;
 using testing::Return;
 using testing::ReturnRef;
 using testing::_;
+using testing::Field;
+using testing::NiceMock;
 
 namespace {
 struct MockSilKitMessageReceiver
@@ -95,6 +97,31 @@ struct MockSilKitMessageReceiver
 };
 
 
+struct MockLogMsgReceiver
+    : public IMessageReceiver<SilKit::Services::Logging::LogMsg>
+    , public IMessageReceiver<SilKit::Services::Logging::LogMsgBatch>
+    , public IServiceEndpoint
+{
+    ServiceDescriptor _serviceDescriptor;
+
+    MockLogMsgReceiver()
+    {
+        _serviceDescriptor.SetServiceId(2);
+        _serviceDescriptor.SetNetworkName("default");
+        _serviceDescriptor.SetParticipantNameAndComputeId("MockLogMsgReceiver");
+    }
+
+    void ReceiveMsg(const IServiceEndpoint*, const SilKit::Services::Logging::LogMsg&) override {}
+    void ReceiveMsg(const IServiceEndpoint*, const SilKit::Services::Logging::LogMsgBatch&) override {}
+
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override { return _serviceDescriptor; }
+};
+
+
 struct MockVAsioPeer
     : public IVAsioPeer
 {
@@ -130,6 +157,7 @@ struct MockVAsioPeer
     MOCK_METHOD(void, StartAsyncRead, (), (override));
     MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
     MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
+    MOCK_METHOD(size_t, GetCompressionThreshold, (), (const, override));
     MOCK_METHOD(void, Shutdown, (), (override));
 
     // IServiceEndpoint (via IVAsioPeer)
@@ -188,6 +216,37 @@ protected:
     {
         _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
     }
+
+    template <typename MessageT>
+    auto GetLinkByName(const std::string& networkName)
+    {
+        return _connection.GetLinkByName<MessageT>(networkName);
+    }
+
+    void AddPeer(std::unique_ptr<IVAsioPeer> peer)
+    {
+        _connection.AddPeer(std::move(peer));
+    }
+
+    void RegisterLogMsgReceiver(MockLogMsgReceiver* receiver)
+    {
+        RegisterSilKitMsgReceiver<Services::Logging::LogMsg, MockLogMsgReceiver>(receiver);
+        RegisterSilKitMsgReceiver<Services::Logging::LogMsgBatch, MockLogMsgReceiver>(receiver);
+    }
+
+    static auto CapabilitiesWithLogMsgBatch() -> std::string
+    {
+        VAsioCapabilities capabilities;
+        capabilities.AddCapability(Capabilities::LogMsgBatch);
+        return capabilities.ToCapabilitiesString();
+    }
+
+    static auto HasSubscriber(const ParticipantAnnouncementReply& reply, const std::string& msgTypeName) -> bool
+    {
+        return std::any_of(reply.subscribers.begin(), reply.subscribers.end(), [&msgTypeName](const auto& subscriber) {
+            return subscriber.msgTypeName == msgTypeName;
+        });
+    }
 };
 
 } // namespace Core
@@ -296,3 +355,111 @@ TEST_F(Test_VAsioConnection, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Mixed versions: message types which require a capability
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, log_msg_batch_is_only_subscribed_at_peers_with_the_capability)
+{
+    const std::string logMsg = SilKitMsgTraits<SilKit::Services::Logging::LogMsg>::SerdesName();
+    const std::string logMsgBatch = SilKitMsgTraits<SilKit::Services::Logging::LogMsgBatch>::SerdesName();
+
+    // a participant of an older version would answer the subscription of LOGMSGBATCH with a failed acknowledge
+    auto olderPeer = std::make_unique<NiceMock<MockVAsioPeer>>();
+    olderPeer->_peerInfo.participantName = "OlderPeer";
+    EXPECT_CALL(*olderPeer, Subscribe(Field(&VAsioMsgSubscriber::msgTypeName, logMsg))).Times(1);
+    EXPECT_CALL(*olderPeer, Subscribe(Field(&VAsioMsgSubscriber::msgTypeName, logMsgBatch))).Times(0);
+
+    auto currentPeer = std::make_unique<NiceMock<MockVAsioPeer>>();
+    currentPeer->_peerInfo.participantName = "CurrentPeer";
+    currentPeer->_peerInfo.capabilities = CapabilitiesWithLogMsgBatch();
+    EXPECT_CALL(*currentPeer, Subscribe(Field(&VAsioMsgSubscriber::msgTypeName, logMsg))).Times(1);
+    EXPECT_CALL(*currentPeer, Subscribe(Field(&VAsioMsgSubscriber::msgTypeName, logMsgBatch))).Times(1);
+
+    EXPECT_CALL(_dummyLogger, Log(SilKit::Services::Logging::Level::Error, _)).Times(0);
+
+    AddPeer(std::move(olderPeer));
+    AddPeer(std::move(currentPeer));
+
+    MockLogMsgReceiver receiver;
+    RegisterLogMsgReceiver(&receiver);
+}
+
+TEST_F(Test_VAsioConnection, log_msg_batch_is_not_announced_to_peers_without_the_capability)
+{
+    const std::string logMsg = SilKitMsgTraits<SilKit::Services::Logging::LogMsg>::SerdesName();
+    const std::string logMsgBatch = SilKitMsgTraits<SilKit::Services::Logging::LogMsgBatch>::SerdesName();
+
+    MockLogMsgReceiver receiver;
+    RegisterLogMsgReceiver(&receiver);
+
+    EXPECT_CALL(_dummyLogger, Log(_, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(_dummyLogger, Log(SilKit::Services::Logging::Level::Error, _)).Times(0);
+
+    // the announcement of a participant of an older version lacks the capability
+    ParticipantAnnouncement announcement{};
+    announcement.peerInfo = _from.GetInfo();
+
+    auto validator = [logMsg, logMsgBatch](const ParticipantAnnouncementReply& reply) {
+        return reply.status == ParticipantAnnouncementReply::Status::Success && HasSubscriber(reply, logMsg)
+               && !HasSubscriber(reply, logMsgBatch);
+    };
+    EXPECT_CALL(_from, SendSilKitMsg(AnnouncementReplyMatcher(validator))).Times(1);
+
+    _connection.OnSocketData(&_from, SerializedMessage{announcement});
+}
+
+TEST_F(Test_VAsioConnection, log_msg_batch_is_announced_to_peers_with_the_capability)
+{
+    const std::string logMsgBatch = SilKitMsgTraits<SilKit::Services::Logging::LogMsgBatch>::SerdesName();
+
+    MockLogMsgReceiver receiver;
+    RegisterLogMsgReceiver(&receiver);
+
+    _from._peerInfo.capabilities = CapabilitiesWithLogMsgBatch();
+
+    ParticipantAnnouncement announcement{};
+    announcement.peerInfo = _from.GetInfo();
+
+    auto validator = [logMsgBatch](const ParticipantAnnouncementReply& reply) {
+        return reply.status == ParticipantAnnouncementReply::Status::Success && HasSubscriber(reply, logMsgBatch);
+    };
+    EXPECT_CALL(_from, SendSilKitMsg(AnnouncementReplyMatcher(validator))).Times(1);
+
+    _connection.OnSocketData(&_from, SerializedMessage{announcement});
+}
+
+//////////////////////////////////////////////////////////////////////
+// Subscription removal
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, subscription_removal_only_removes_the_given_subscription_of_the_peer)
+{
+    using SilKit::Services::PubSub::WireDataMessageEvent;
+
+    VAsioMsgSubscriber subscriber;
+    subscriber.msgTypeName = SilKitMsgTraits<WireDataMessageEvent>::SerdesName();
+    subscriber.networkName = "PublisherLink";
+    subscriber.version = SilKitMsgTraits<WireDataMessageEvent>::Version();
+    subscriber.receiverIdx = 7;
+
+    // the peer subscribed the link for two of its receivers
+    auto otherSubscriber = subscriber;
+    otherSubscriber.receiverIdx = 8;
+
+    EXPECT_CALL(_from, SendSilKitMsg(SubscriptionAcknowledgeMatcher(subscriber))).Times(1);
+    EXPECT_CALL(_from, SendSilKitMsg(SubscriptionAcknowledgeMatcher(otherSubscriber))).Times(1);
+    _connection.OnSocketData(&_from, SerializedMessage{subscriber});
+    _connection.OnSocketData(&_from, SerializedMessage{otherSubscriber});
+
+    auto link = GetLinkByName<WireDataMessageEvent>("PublisherLink");
+    ASSERT_EQ(link->GetNumberOfRemoteReceivers(), 2u);
+
+    _connection.OnSocketData(&_from, SerializedMessage{SubscriptionRemoval{subscriber}});
+    EXPECT_EQ(link->GetNumberOfRemoteReceivers(), 1u);
+
+    // removing it again has no effect
+    _connection.OnSocketData(&_from, SerializedMessage{SubscriptionRemoval{subscriber}});
+    EXPECT_EQ(link->GetNumberOfRemoteReceivers(), 1u);
+}
@@ -0,0 +1,399 @@
+// Copyright (c) 2023 Vector Informatik GmbH
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+// LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+// OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "VAsioPeer.hpp"
+#include "VAsioCapabilities.hpp"
+
+#include "MockLogger.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockRawByteStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::SaveArg;
+using ::testing::Sequence;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::ConstBufferSequence;
+using VSilKit::IRawByteStreamListener;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+using VSilKit::MutableBufferSequence;
+
+
+struct MockVAsioPeerListener : IVAsioPeerListener
+{
+    MOCK_METHOD(void, OnSocketData, (IVAsioPeer*, SerializedMessage&&), (override));
+    MOCK_METHOD(void, OnPeerShutdown, (IVAsioPeer*), (override));
+};
+
+
+auto MakeMessage(uint8_t fill) -> SerializedMessage
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{fill};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(100, fill)};
+    return SerializedMessage{event, EndpointAddress{1, 2}, EndpointId{3}};
+}
+
+auto MessageSize(uint8_t fill) -> size_t
+{
+    return MakeMessage(fill).ReleaseStorage().size();
+}
+
+auto TotalSize(ConstBufferSequence bufferSequence) -> size_t
+{
+    size_t size{0};
+    for (const auto& buffer : bufferSequence)
+    {
+        size += buffer.GetSize();
+    }
+    return size;
+}
+
+
+struct Test_VAsioPeer : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    NiceMock<MockVAsioPeerListener> peerListener;
+
+    MockRawByteStream* stream{nullptr};
+    IRawByteStreamListener* streamListener{nullptr};
+
+    auto MakePeer(VAsioPeerSettings settings) -> std::unique_ptr<VAsioPeer>
+    {
+        auto rawByteStream{std::make_unique<NiceMock<MockRawByteStream>>()};
+        stream = rawByteStream.get();
+        EXPECT_CALL(*stream, SetListener).WillOnce([this](IRawByteStreamListener& listener) {
+            streamListener = &listener;
+        });
+        return std::make_unique<VAsioPeer>(&peerListener, &ioContext, std::move(rawByteStream), &logger, settings);
+    }
+
+    //! Each read operation of the stream delivers the next chunk, as far as it fits into the provided buffer.
+    void DeliverChunksOnRead(std::deque<std::vector<uint8_t>>& chunks)
+    {
+        EXPECT_CALL(*stream, AsyncReadSome).WillRepeatedly([this, &chunks](MutableBufferSequence bufferSequence) {
+            if (chunks.empty())
+            {
+                return;
+            }
+
+            auto& chunk = chunks.front();
+            const auto& buffer = bufferSequence[0];
+            const auto size = std::min(buffer.GetSize(), chunk.size());
+            std::memcpy(buffer.GetData(), chunk.data(), size);
+            chunk.erase(chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(size));
+            if (chunk.empty())
+            {
+                chunks.pop_front();
+            }
+
+            ioContext.Post([this, size] {
+                streamListener->OnAsyncReadSomeDone(*stream, size);
+            });
+        });
+    }
+};
+
+
+TEST_F(Test_VAsioPeer, without_batching_each_message_is_written_individually)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    const auto messageSize{MessageSize(0)};
+
+    size_t writeCount{0};
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(3).WillRepeatedly([&](ConstBufferSequence bufferSequence) {
+        ++writeCount;
+        EXPECT_EQ(TotalSize(bufferSequence), messageSize);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, messageSize);
+        });
+    });
+
+    for (uint8_t index = 0; index != 3; ++index)
+    {
+        peer->SendSilKitMsg(MakeMessage(index));
+    }
+
+    ioContext.Run();
+
+    EXPECT_EQ(writeCount, 3u);
+}
+
+TEST_F(Test_VAsioPeer, compact_network_headers_are_used_if_the_peer_has_the_capability)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    VAsioCapabilities capabilities;
+    capabilities.AddCapability(Capabilities::CompactNetworkHeader);
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "CompactPeer";
+    peerInfo.capabilities = capabilities.ToCapabilitiesString();
+    peer->SetInfo(peerInfo);
+
+    auto compactMessage{MakeMessage(0)};
+    compactMessage.UseCompactNetworkHeaders();
+    const auto compactMessageSize{compactMessage.ReleaseStorage().size()};
+    ASSERT_LT(compactMessageSize, MessageSize(0));
+
+    EXPECT_CALL(*stream, AsyncWriteSome).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), compactMessageSize);
+        ioContext.Post([this, compactMessageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, compactMessageSize);
+        });
+    });
+
+    peer->SendSilKitMsg(MakeMessage(0));
+
+    ioContext.Run();
+}
+
+TEST_F(Test_VAsioPeer, large_messages_are_compressed_if_the_peer_has_the_capability)
+{
+    VAsioPeerSettings settings;
+    settings.compressionThreshold = 64;
+    auto sender{MakePeer(settings)};
+
+    VAsioCapabilities capabilities;
+    capabilities.AddCapability(Capabilities::Compression);
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "CompressingPeer";
+    peerInfo.capabilities = capabilities.ToCapabilitiesString();
+    sender->SetInfo(peerInfo);
+
+    std::vector<uint8_t> written;
+    EXPECT_CALL(*stream, AsyncWriteSome).WillOnce([&](ConstBufferSequence bufferSequence) {
+        for (const auto& buffer : bufferSequence)
+        {
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            written.insert(written.end(), data, data + buffer.GetSize());
+        }
+        ioContext.Post([this, size = written.size()] {
+            streamListener->OnAsyncWriteSomeDone(*stream, size);
+        });
+    });
+
+    sender->SendSilKitMsg(MakeMessage(7));
+    ioContext.Run();
+
+    ASSERT_LT(written.size(), MessageSize(7));
+    EXPECT_EQ(static_cast<VAsioMsgKind>(written[sizeof(uint32_t)]), VAsioMsgKind::SilKitCompressedMsg);
+
+    const auto sendStatistics = sender->GetCompressionStatistics();
+    EXPECT_EQ(sendStatistics.messagesCompressed, 1u);
+    EXPECT_EQ(sendStatistics.bytesBeforeCompression, MessageSize(7));
+    EXPECT_EQ(sendStatistics.bytesAfterCompression, written.size());
+
+    // the receiving peer dispatches the message with the compressed body, which is decompressed on deserialization
+    auto receiver{MakePeer(VAsioPeerSettings{})};
+
+    std::deque<std::vector<uint8_t>> chunks{written};
+    DeliverChunksOnRead(chunks);
+
+    EXPECT_CALL(peerListener, OnSocketData).WillOnce([&](IVAsioPeer*, SerializedMessage&& message) {
+        ASSERT_EQ(message.GetMessageKind(), VAsioMsgKind::SilKitMwMsg);
+        EXPECT_EQ(message.GetRemoteIndex(), EndpointId{3});
+        const auto event = message.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        EXPECT_EQ(event.timestamp, std::chrono::nanoseconds{7});
+        EXPECT_EQ(SilKit::Util::ToStdVector(event.data.AsSpan()), std::vector<uint8_t>(100, 7));
+    });
+
+    receiver->StartAsyncRead();
+    ioContext.Run();
+
+    EXPECT_EQ(receiver->GetCompressionStatistics().messagesReceivedCompressed, 1u);
+}
+
+TEST_F(Test_VAsioPeer, messages_to_peers_without_the_capability_are_not_compressed)
+{
+    VAsioPeerSettings settings;
+    settings.compressionThreshold = 64;
+    auto peer{MakePeer(settings)};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "PlainPeer";
+    peer->SetInfo(peerInfo);
+
+    const auto messageSize{MessageSize(0)};
+    EXPECT_CALL(*stream, AsyncWriteSome).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), messageSize);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, messageSize);
+        });
+    });
+
+    peer->SendSilKitMsg(MakeMessage(0));
+    ioContext.Run();
+
+    EXPECT_EQ(peer->GetCompressionStatistics().messagesCompressed, 0u);
+}
+
+TEST_F(Test_VAsioPeer, queued_messages_are_batched_up_to_max_messages)
+{
+    VAsioPeerSettings settings;
+    settings.sendBatchMaxMessages = 3;
+    auto peer{MakePeer(settings)};
+
+    const auto messageSize{MessageSize(0)};
+
+    Sequence s1;
+
+    EXPECT_CALL(*stream, AsyncWriteSome).InSequence(s1).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), 3 * messageSize);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, 3 * messageSize);
+        });
+    });
+    EXPECT_CALL(*stream, AsyncWriteSome).InSequence(s1).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), 2 * messageSize);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, 2 * messageSize);
+        });
+    });
+
+    for (uint8_t index = 0; index != 5; ++index)
+    {
+        peer->SendSilKitMsg(MakeMessage(index));
+    }
+
+    ioContext.Run();
+}
+
+TEST_F(Test_VAsioPeer, batches_are_limited_by_max_bytes_and_partial_writes_are_resumed)
+{
+    const auto messageSize{MessageSize(0)};
+
+    VAsioPeerSettings settings;
+    settings.sendBatchMaxMessages = 16;
+    settings.sendBatchMaxBytes = 2 * messageSize;
+    auto peer{MakePeer(settings)};
+
+    Sequence s1;
+
+    // the first batch is written in two parts, the second part must start right after the first
+    EXPECT_CALL(*stream, AsyncWriteSome).InSequence(s1).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), 2 * messageSize);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, messageSize + 7);
+        });
+    });
+    EXPECT_CALL(*stream, AsyncWriteSome).InSequence(s1).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), messageSize - 7);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, messageSize - 7);
+        });
+    });
+    EXPECT_CALL(*stream, AsyncWriteSome).InSequence(s1).WillOnce([&](ConstBufferSequence bufferSequence) {
+        EXPECT_EQ(TotalSize(bufferSequence), messageSize);
+        ioContext.Post([this, messageSize] {
+            streamListener->OnAsyncWriteSomeDone(*stream, messageSize);
+        });
+    });
+
+    for (uint8_t index = 0; index != 3; ++index)
+    {
+        peer->SendSilKitMsg(MakeMessage(index));
+    }
+
+    ioContext.Run();
+}
+
+TEST_F(Test_VAsioPeer, multiple_messages_in_one_read_are_dispatched_in_order)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    // three complete messages and the beginning of a fourth one arrive in a single read, the rest arrives later
+    std::vector<uint8_t> firstChunk;
+    for (uint8_t index = 0; index != 4; ++index)
+    {
+        const auto bytes = MakeMessage(index).ReleaseStorage();
+        firstChunk.insert(firstChunk.end(), bytes.begin(), bytes.end());
+    }
+    const auto splitPosition = firstChunk.size() - 50;
+    std::vector<uint8_t> secondChunk{firstChunk.begin() + static_cast<std::ptrdiff_t>(splitPosition), firstChunk.end()};
+    firstChunk.resize(splitPosition);
+
+    std::deque<std::vector<uint8_t>> chunks{firstChunk, secondChunk};
+    DeliverChunksOnRead(chunks);
+
+    std::vector<std::chrono::nanoseconds> timestamps;
+    EXPECT_CALL(peerListener, OnSocketData).Times(4).WillRepeatedly([&](IVAsioPeer*, SerializedMessage&& message) {
+        ASSERT_EQ(message.GetMessageKind(), VAsioMsgKind::SilKitMwMsg);
+        EXPECT_EQ(message.GetRemoteIndex(), EndpointId{3});
+        const auto event = message.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        EXPECT_EQ(event.data.AsSpan().size(), 100u);
+        timestamps.push_back(event.timestamp);
+    });
+
+    peer->StartAsyncRead();
+    ioContext.Run();
+
+    EXPECT_TRUE(chunks.empty());
+    EXPECT_EQ(timestamps, (std::vector<std::chrono::nanoseconds>{std::chrono::nanoseconds{0}, std::chrono::nanoseconds{1},
+                                                                 std::chrono::nanoseconds{2}, std::chrono::nanoseconds{3}}));
+}
+
+TEST_F(Test_VAsioPeer, message_larger_than_the_initial_receive_buffer_is_reassembled)
+{
+    auto peer{MakePeer(VAsioPeerSettings{})};
+
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{42};
+    event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(10000, 0xAB)};
+
+    std::deque<std::vector<uint8_t>> chunks{SerializedMessage{event, EndpointAddress{1, 2}, EndpointId{3}}.ReleaseStorage()};
+    DeliverChunksOnRead(chunks);
+
+    EXPECT_CALL(peerListener, OnSocketData).WillOnce([&](IVAsioPeer*, SerializedMessage&& message) {
+        const auto received = message.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        EXPECT_EQ(received.timestamp, event.timestamp);
+        EXPECT_EQ(SilKit::Util::ToStdVector(received.data.AsSpan()), std::vector<uint8_t>(10000, 0xAB));
+    });
+
+    peer->StartAsyncRead();
+    ioContext.Run();
+
+    EXPECT_TRUE(chunks.empty());
+}
+
+
+} // namespace
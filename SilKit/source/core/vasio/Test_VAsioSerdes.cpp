@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioSerdes.hpp"
 
 #include <chrono>
+#include <limits>
 
 #include "gtest/gtest.h"
 
@@ -143,4 +144,52 @@ TEST(Test_VAsioSerdes, vasio_knownParticipants)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_VAsioSerdes, compact_endpoint_ids)
+{
+    MessageBuffer buffer;
+
+    const std::vector<EndpointId> endpointIds{0, 1, 127, 128, 300, 1u << 20, std::numeric_limits<EndpointId>::max()};
+    for (const auto endpointId : endpointIds)
+    {
+        WriteCompactEndpointId(buffer, endpointId);
+    }
+
+    // small ids occupy a single byte
+    EXPECT_EQ(buffer.WrittenSize(), 1u + 1u + 1u + 2u + 2u + 3u + 10u);
+
+    for (const auto endpointId : endpointIds)
+    {
+        EXPECT_EQ(ExtractCompactEndpointId(buffer), endpointId);
+    }
+}
+
+TEST(Test_VAsioSerdes, compact_endpoint_ids_reject_overlong_encodings)
+{
+    const auto extractFrom = [](std::vector<uint8_t> bytes) {
+        MessageBuffer buffer;
+        for (const auto byte : bytes)
+        {
+            buffer << byte;
+        }
+        return ExtractCompactEndpointId(buffer);
+    };
+
+    const std::vector<uint8_t> nineContinuationBytes(9, 0xff);
+
+    auto maxValue = nineContinuationBytes;
+    maxValue.push_back(0x01);
+    EXPECT_EQ(extractFrom(maxValue), std::numeric_limits<EndpointId>::max());
+
+    // 10th byte with bits beyond the 64th
+    auto overflowing = nineContinuationBytes;
+    overflowing.push_back(0x02);
+    EXPECT_THROW(extractFrom(overflowing), SilKit::ProtocolError);
+
+    // 10th byte with the continuation bit set
+    auto overlong = nineContinuationBytes;
+    overlong.push_back(0x81);
+    overlong.push_back(0x00);
+    EXPECT_THROW(extractFrom(overlong), SilKit::ProtocolError);
+}
+
 } // namespace
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "VAsioTransmitter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "MockVAsioPeer.hpp"
+
+#include "Hash.hpp"
+#include "ServiceConfigKeys.hpp"
+#include "WireDataMessages.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::Can;
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::ReturnRef;
+
+
+struct DummyServiceEndpoint : IServiceEndpoint
+{
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override { return _serviceDescriptor; }
+
+private:
+    ServiceDescriptor _serviceDescriptor;
+};
+
+
+class Test_VAsioTransmitter : public testing::Test
+{
+protected:
+    Test_VAsioTransmitter()
+    {
+        _filteredPeerInfo.participantName = "Filtered";
+        _filteredPeerInfo.participantId = SilKit::Util::Hash::Hash(_filteredPeerInfo.participantName);
+        ON_CALL(_filteredPeer, GetInfo()).WillByDefault(ReturnRef(_filteredPeerInfo));
+
+        _otherPeerInfo.participantName = "Other";
+        _otherPeerInfo.participantId = SilKit::Util::Hash::Hash(_otherPeerInfo.participantName);
+        ON_CALL(_otherPeer, GetInfo()).WillByDefault(ReturnRef(_otherPeerInfo));
+
+        ServiceDescriptor senderDescriptor{"Sender", "CAN1", "CanController1", 1};
+        _sender.SetServiceDescriptor(senderDescriptor);
+
+        _transmitter.AddRemoteReceiver(&_filteredPeer, 1);
+        _transmitter.AddRemoteReceiver(&_otherPeer, 1);
+    }
+
+    static auto MakeCanControllerDescriptor(const std::string& participantName, EndpointId serviceId,
+                                            const std::string& acceptanceFilters) -> ServiceDescriptor
+    {
+        ServiceDescriptor serviceDescriptor{participantName, "CAN1", "CanController1", serviceId};
+        serviceDescriptor.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeCan);
+        serviceDescriptor.SetSupplementalDataItem(Discovery::supplKeyCanControllerAcceptanceFilters,
+                                                  acceptanceFilters);
+        return serviceDescriptor;
+    }
+
+    static auto MakeFrameEvent(uint32_t canId, CanFrameFlagMask flags = 0) -> WireCanFrameEvent
+    {
+        WireCanFrameEvent frameEvent{};
+        frameEvent.frame.canId = canId;
+        frameEvent.frame.flags = flags;
+        frameEvent.direction = SilKit::Services::TransmitDirection::RX;
+        return frameEvent;
+    }
+
+protected:
+    VAsioPeerInfo _filteredPeerInfo;
+    VAsioPeerInfo _otherPeerInfo;
+    NiceMock<MockVAsioPeer> _filteredPeer;
+    NiceMock<MockVAsioPeer> _otherPeer;
+    DummyServiceEndpoint _sender;
+    VAsioTransmitter<WireCanFrameEvent> _transmitter;
+};
+
+
+TEST_F(Test_VAsioTransmitter, can_frames_are_only_sent_to_peers_accepting_them)
+{
+    _transmitter.AddRemoteService(MakeCanControllerDescriptor("Filtered", 1, "100/7f0/0/0"));
+
+    EXPECT_CALL(_filteredPeer, SendSilKitMsg(_)).Times(1);
+    EXPECT_CALL(_otherPeer, SendSilKitMsg(_)).Times(2);
+
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x105));
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x205));
+}
+
+TEST_F(Test_VAsioTransmitter, can_frames_are_filtered_by_their_identifier_format)
+{
+    // accepts the standard frame 0x105, but not the extended frame with the same numeric identifier
+    _transmitter.AddRemoteService(MakeCanControllerDescriptor("Filtered", 1, "100/7f0/0/200"));
+
+    EXPECT_CALL(_filteredPeer, SendSilKitMsg(_)).Times(1);
+    EXPECT_CALL(_otherPeer, SendSilKitMsg(_)).Times(2);
+
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x105));
+    _transmitter.ReceiveMsg(&_sender,
+                            MakeFrameEvent(0x105, static_cast<CanFrameFlagMask>(CanFrameFlag::Ide)));
+}
+
+TEST_F(Test_VAsioTransmitter, peers_with_an_unfiltered_service_receive_all_can_frames)
+{
+    _transmitter.AddRemoteService(MakeCanControllerDescriptor("Filtered", 1, "100/7f0/0/0"));
+    _transmitter.AddRemoteService(ServiceDescriptor{"Filtered", "CAN1", "NetworkSimulator", 2});
+
+    EXPECT_CALL(_filteredPeer, SendSilKitMsg(_)).Times(2);
+
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x105));
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x205));
+}
+
+TEST_F(Test_VAsioTransmitter, removed_services_no_longer_filter_can_frames)
+{
+    const auto serviceDescriptor = MakeCanControllerDescriptor("Filtered", 1, "100/7f0/0/0");
+    _transmitter.AddRemoteService(serviceDescriptor);
+    _transmitter.RemoveRemoteService(serviceDescriptor);
+
+    EXPECT_CALL(_filteredPeer, SendSilKitMsg(_)).Times(1);
+
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x205));
+}
+
+TEST_F(Test_VAsioTransmitter, transmitted_can_frames_are_not_filtered)
+{
+    _transmitter.AddRemoteService(MakeCanControllerDescriptor("Filtered", 1, "100/7f0/0/0"));
+
+    EXPECT_CALL(_filteredPeer, SendSilKitMsg(_)).Times(1);
+
+    auto frameEvent = MakeFrameEvent(0x205);
+    frameEvent.direction = SilKit::Services::TransmitDirection::TX;
+    _transmitter.ReceiveMsg(&_sender, frameEvent);
+}
+
+TEST_F(Test_VAsioTransmitter, updated_services_replace_their_filters)
+{
+    _transmitter.AddRemoteService(MakeCanControllerDescriptor("Filtered", 1, "100/7f0/0/0"));
+    _transmitter.AddRemoteService(MakeCanControllerDescriptor("Filtered", 1, "200/7f0/0/0"));
+
+    EXPECT_CALL(_filteredPeer, SendSilKitMsg(_)).Times(1);
+
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x105));
+    _transmitter.ReceiveMsg(&_sender, MakeFrameEvent(0x205));
+}
+
+
+TEST(Test_VAsioTransmitterOrdering, concurrently_sent_messages_reach_the_wire_in_the_order_of_the_history)
+{
+    using SilKit::Services::PubSub::WireDataMessageEvent;
+
+    // Records the timestamps of the messages sent to a peer, starting with the one replayed from the history
+    struct RecordingPeer
+    {
+        explicit RecordingPeer(const std::string& participantName)
+        {
+            info.participantName = participantName;
+            info.participantId = SilKit::Util::Hash::Hash(participantName);
+            ON_CALL(peer, GetInfo()).WillByDefault(ReturnRef(info));
+            ON_CALL(peer, SendSilKitMsg(_)).WillByDefault([this](SerializedMessage message) {
+                SerializedMessage received{message.ReleaseStorage()};
+                std::lock_guard<std::mutex> lock{mutex};
+                timestamps.push_back(received.Deserialize<WireDataMessageEvent>().timestamp.count());
+            });
+        }
+
+        VAsioPeerInfo info;
+        NiceMock<MockVAsioPeer> peer;
+        std::mutex mutex;
+        std::vector<int64_t> timestamps;
+    };
+
+    DummyServiceEndpoint sender;
+    sender.SetServiceDescriptor(ServiceDescriptor{"Sender", "Topic", "DataPublisher1", 1});
+
+    VAsioTransmitter<WireDataMessageEvent> transmitter;
+
+    RecordingPeer firstPeer{"First"};
+    transmitter.AddRemoteReceiver(&firstPeer.peer, 1);
+
+    constexpr int numThreads{4};
+    constexpr int numMessagesPerThread{2000};
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < numThreads; ++thread)
+    {
+        threads.emplace_back([&transmitter, &sender, thread] {
+            WireDataMessageEvent event;
+            event.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(64, 0xAB)};
+            for (int index = 0; index < numMessagesPerThread; ++index)
+            {
+                event.timestamp = std::chrono::nanoseconds{thread * numMessagesPerThread + index};
+                transmitter.ReceiveMsg(&sender, event);
+            }
+        });
+    }
+
+    // Peers which are added while the messages are sent receive the last saved message from the history first
+    std::vector<std::unique_ptr<RecordingPeer>> latePeers;
+    for (int index = 0; index < 50; ++index)
+    {
+        latePeers.push_back(std::make_unique<RecordingPeer>("Late" + std::to_string(index)));
+        transmitter.AddRemoteReceiver(&latePeers.back()->peer, 1);
+        std::this_thread::yield();
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto& expected = firstPeer.timestamps;
+    ASSERT_EQ(expected.size(), static_cast<size_t>(numThreads * numMessagesPerThread));
+
+    // Each late peer must see a contiguous tail of the messages seen by the first peer
+    for (const auto& latePeer : latePeers)
+    {
+        const auto& actual = latePeer->timestamps;
+        if (actual.empty())
+        {
+            continue;
+        }
+
+        const auto start = std::find(expected.begin(), expected.end(), actual.front());
+        ASSERT_NE(start, expected.end());
+        EXPECT_TRUE(std::equal(actual.begin(), actual.end(), start, expected.end()))
+            << latePeer->info.participantName << " received the messages in a different order";
+    }
+}
+
+} // namespace
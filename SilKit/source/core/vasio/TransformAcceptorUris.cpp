@@ -56,7 +56,7 @@ inline auto GetUriInfo(const Uri& uri) -> UriInfo
         return host;
     }(uri.Host());
 
-    if (uri.Type() == Uri::UriType::Local)
+    if (uri.Type() == Uri::UriType::Local || uri.Type() == Uri::UriType::SharedMemory)
     {
         UriInfo hostInfo;
         hostInfo.local = true;
@@ -116,13 +116,15 @@ auto TransformAcceptorUris(SilKit::Services::Logging::ILogger* logger, IVAsioPee
 
     // sanity checks
 
-    if (src.Type() != Uri::UriType::Local && src.Type() != Uri::UriType::Tcp)
+    if (src.Type() != Uri::UriType::Local && src.Type() != Uri::UriType::SharedMemory
+        && src.Type() != Uri::UriType::Tcp)
     {
         throw SilKitError{
             "SIL Kit Registry: TransformAcceptorUris: Remote address of advertised peer has invalid UriType"};
     }
 
-    if (dst.Type() != Uri::UriType::Local && dst.Type() != Uri::UriType::Tcp)
+    if (dst.Type() != Uri::UriType::Local && dst.Type() != Uri::UriType::SharedMemory
+        && dst.Type() != Uri::UriType::Tcp)
     {
         throw SilKitError{"SIL Kit Registry: TransformAcceptorUris: Local address of audience peer has invalid UriType"};
     }
@@ -190,8 +192,8 @@ auto TransformAcceptorUris(SilKit::Services::Logging::ILogger* logger, IVAsioPee
         acceptUri(uri);
     }
 
-    // Order the acceptor URIs before sending them to the audience participant. Local-domain acceptors always have the
-    // highest priority.
+    // Order the acceptor URIs before sending them to the audience participant. Shared-memory and local-domain acceptors
+    // always have the highest priority.
 
     std::multimap<int, std::string> orderedAcceptorUris;
 
@@ -201,7 +203,7 @@ auto TransformAcceptorUris(SilKit::Services::Logging::ILogger* logger, IVAsioPee
     // If the audience is connecting from a non-local address (neither local-domain, nor tcp-loopback), then send
     // tcp-loopback acceptors after non-local acceptors.
 
-    int localDomainPenalty = 0, nonLocalPenalty = 1000, loopbackPenalty = 2000;
+    int sharedMemoryPenalty = 0, localDomainPenalty = 100, nonLocalPenalty = 1000, loopbackPenalty = 2000;
 
     if (dstInfo.local)
     {
@@ -213,6 +215,12 @@ auto TransformAcceptorUris(SilKit::Services::Logging::ILogger* logger, IVAsioPee
 
     for (const auto& uri : acceptorUris)
     {
+        if (uri.Type() == Uri::UriType::SharedMemory)
+        {
+            orderedAcceptorUris.emplace(sharedMemoryPenalty, uri.EncodedString());
+            continue;
+        }
+
         if (uri.Type() == Uri::UriType::Local)
         {
             orderedAcceptorUris.emplace(localDomainPenalty, uri.EncodedString());
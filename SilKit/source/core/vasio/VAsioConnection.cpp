@@ -31,6 +31,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <functional>
 #include <cctype>
 #include <map>
+#include <limits>
 
 #include "ILogger.hpp"
 #include "VAsioPeer.hpp"
@@ -180,6 +181,10 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
     SilKit::Core::VAsioCapabilities capabilities;
 
     capabilities.AddCapability(SilKit::Core::Capabilities::AutonomousSynchronous);
+    capabilities.AddCapability(SilKit::Core::Capabilities::CompactNetworkHeader);
+    capabilities.AddCapability(SilKit::Core::Capabilities::Compression);
+    capabilities.AddCapability(SilKit::Core::Capabilities::LogMsgBatch);
+    capabilities.AddCapability(SilKit::Core::Capabilities::SubscriptionRemoval);
 
     if (participantConfiguration.middleware.registryAsFallbackProxy)
     {
@@ -247,6 +252,15 @@ auto MakeConnectKnownParticipantsSettings(const SilKit::Config::ParticipantConfi
     return settings;
 }
 
+auto MakeVAsioPeerSettings(const SilKit::Config::ParticipantConfiguration& config) -> SilKit::Core::VAsioPeerSettings
+{
+    SilKit::Core::VAsioPeerSettings settings;
+    settings.sendBatchMaxMessages = static_cast<size_t>(std::max(1, config.middleware.sendBatchMaxMessages));
+    settings.sendBatchMaxBytes = static_cast<size_t>(std::max(1, config.middleware.sendBatchMaxBytes));
+    settings.compressionThreshold = static_cast<size_t>(std::max(0, config.middleware.compressionThreshold));
+    return settings;
+}
+
 auto MakeRemoteConnectionManagerSettings(const SilKit::Config::ParticipantConfiguration& config)
     -> SilKit::Core::RemoteConnectionManagerSettings
 {
@@ -321,6 +335,11 @@ VAsioConnection::~VAsioConnection()
     {
         _ioWorker.join();
     }
+
+    if (_ioWorkerPool != nullptr)
+    {
+        _ioWorkerPool->Stop();
+    }
 }
 
 void VAsioConnection::SetLogger(Services::Logging::ILogger* logger)
@@ -350,6 +369,12 @@ auto VAsioConnection::PrepareAcceptorEndpointUris(const std::string & connectUri
         // Create the default local-domain socket path.
         auto localEndpoint = makeLocalEndpoint(_participantName, _participantId, connectUri);
         acceptorEndpointUris.emplace_back("local://" + localEndpoint.path());
+
+        if (_config.middleware.enableSharedMemory)
+        {
+            // The shared-memory acceptor uses its own local-domain socket for the initial handshake and wake-ups.
+            acceptorEndpointUris.emplace_back("shm://" + localEndpoint.path() + "-shm");
+        }
     }
 
     return acceptorEndpointUris;
@@ -388,7 +413,8 @@ void VAsioConnection::OpenTcpAcceptors(const std::vector<std::string> & acceptor
                 }
             }
         }
-        else if (uri.Type() == Uri::UriType::Local && uri.Scheme() == "local")
+        else if ((uri.Type() == Uri::UriType::Local && uri.Scheme() == "local")
+                 || (uri.Type() == Uri::UriType::SharedMemory && uri.Scheme() == "shm"))
         {
             // do nothing, handled elsewhere
         }
@@ -431,7 +457,8 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
                                          exception.what());
             }
         }
-        else if (uri.Type() == Uri::UriType::Tcp && uri.Scheme() == "tcp")
+        else if ((uri.Type() == Uri::UriType::Tcp && uri.Scheme() == "tcp")
+                 || (uri.Type() == Uri::UriType::SharedMemory && uri.Scheme() == "shm"))
         {
             // do nothing, handled elsewhere
         }
@@ -442,6 +469,43 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
     }
 }
 
+void VAsioConnection::OpenSharedMemoryAcceptors(const std::vector<std::string>& acceptorEndpointUris)
+{
+    for (const auto& uriString : acceptorEndpointUris)
+    {
+        const auto uri = Uri::Parse(uriString);
+
+        if (uri.Type() != Uri::UriType::SharedMemory || uri.Scheme() != "shm")
+        {
+            // do nothing, handled elsewhere
+            continue;
+        }
+
+        SilKit::Services::Logging::Debug(_logger, "Found shared memory acceptor endpoint URI {} with path {}",
+                                         uriString, uri.Path());
+
+        // file must not exist before we bind/listen on it
+        (void)fs::remove(uri.Path());
+
+        try
+        {
+            auto acceptor{_ioContext->MakeSharedMemoryAcceptor(uri.Path())};
+            acceptor->SetListener(*this);
+            acceptor->AsyncAccept({});
+
+            {
+                std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
+                _acceptors.emplace_back(std::move(acceptor));
+            }
+        }
+        catch (const std::exception& exception)
+        {
+            Services::Logging::Error(_logger, "Unable to accept shared memory connections on '{}': {}", uri.Path(),
+                                     exception.what());
+        }
+    }
+}
+
 void VAsioConnection::JoinSimulation(std::string connectUri)
 {
     SILKIT_ASSERT(_logger);
@@ -473,6 +537,11 @@ void VAsioConnection::OpenParticipantAcceptors(const std::string& connectUri)
         OpenLocalAcceptors(acceptorEndpointUris);
     }
 
+    if (_config.middleware.enableSharedMemory)
+    {
+        OpenSharedMemoryAcceptors(acceptorEndpointUris);
+    }
+
     // Accept TCP connections on endpoints given by matching URIs
     OpenTcpAcceptors(acceptorEndpointUris);
 
@@ -693,6 +762,7 @@ void VAsioConnection::ReceiveParticipantAnnouncement(IVAsioPeer* from, Serialize
     auto serviceDescriptor = service.GetServiceDescriptor();
     serviceDescriptor.SetParticipantNameAndComputeId(announcement.peerInfo.participantName);
     service.SetServiceDescriptor(serviceDescriptor);
+    _remoteServiceEndpoints.erase(from);
 
     // If one of the handlers for ParticipantAnnouncements throws an exception, report failure to the remote peer
     try
@@ -732,6 +802,12 @@ void VAsioConnection::SendParticipantAnnouncementReply(IVAsioPeer* peer)
                    [](const auto& subscriber) {
                        return subscriber->GetDescriptor();
                    });
+    reply.subscribers.insert(reply.subscribers.end(), _additionalSubscriptions.begin(), _additionalSubscriptions.end());
+    reply.subscribers.erase(std::remove_if(reply.subscribers.begin(), reply.subscribers.end(),
+                                           [peer](const auto& subscriber) {
+                                               return !PeerSupportsSubscription(peer, subscriber);
+                                           }),
+                            reply.subscribers.end());
 
     Services::Logging::Debug(_logger, "Sending ParticipantAnnouncementReply to '{}' with protocol version {}",
                              peer->GetInfo().participantName, ExtractProtocolVersion(reply.remoteHeader));
@@ -1050,6 +1126,7 @@ void VAsioConnection::HandleConnectedPeer(IVAsioPeer* peer)
     ServiceDescriptor peerId;
     peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
     peer->SetServiceDescriptor(peerId);
+    _remoteServiceEndpoints.erase(peer);
 
     AssociateParticipantNameAndPeer(peer->GetInfo().participantName, peer);
 }
@@ -1084,6 +1161,13 @@ void VAsioConnection::StartIoWorker()
         return;
     }
 
+    if (_config.middleware.ioWorkerThreads > 1)
+    {
+        // the IO worker thread itself is counted as well
+        _ioWorkerPool = std::make_unique<IoWorkerPool>(static_cast<size_t>(_config.middleware.ioWorkerThreads - 1),
+                                                       "IO Wrk ", _logger);
+    }
+
     _ioWorker = std::thread{[this]() {
         SilKit::Util::SetThreadName(("IO " + _participantName).substr(0, 15));
 
@@ -1241,6 +1325,15 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
             RemovePeerFromLinks(peer);
             RemovePeerFromConnection(peer);
         }
+
+        _ioWorkerPeerStates.erase(peer);
+        _remoteServiceEndpoints.erase(peer);
+
+        _proxyRelayedPeers.erase(peer);
+        for (auto& relayedPeers : _proxyRelayedPeers)
+        {
+            relayedPeers.second.erase(peer);
+        }
     }
 }
 
@@ -1295,10 +1388,29 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
         return hay.get() == needle;
     })};
 
-    if (it != _peers.end())
+    if (it == _peers.end())
     {
-        _peers.erase(it);
+        return;
     }
+
+    // Other threads may have dispatched writes to the peer, which are still queued in the IO context. The peer has
+    // already been removed from the links, so no further writes are dispatched, and the peer is destroyed after the
+    // queued ones have run.
+    _removedPeers.emplace_back(std::move(*it));
+    _peers.erase(it);
+
+    _ioContext->Post([this, peer] {
+        std::lock_guard<decltype(_peersLock)> lock{_peersLock};
+
+        auto removedIt{std::find_if(_removedPeers.begin(), _removedPeers.end(), [needle = peer](const auto& hay) {
+            return hay.get() == needle;
+        })};
+
+        if (removedIt != _removedPeers.end())
+        {
+            _removedPeers.erase(removedIt);
+        }
+    });
 }
 
 void VAsioConnection::NotifyShutdown()
@@ -1318,14 +1430,24 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveSubscriptionAnnouncement(from, std::move(buffer));
     case VAsioMsgKind::SubscriptionAcknowledge:
         return ReceiveSubscriptionAcknowledge(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionRemoval:
+        return ReceiveSubscriptionRemoval(from, std::move(buffer));
     case VAsioMsgKind::SilKitMwMsg:
         return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitSimMsg:
         return ReceiveRawSilKitMessage(from, std::move(buffer));
+    case VAsioMsgKind::SilKitCompactMwMsg:
+    case VAsioMsgKind::SilKitCompactSimMsg:
+        // Not reported by the SerializedMessage, compact network headers are converted when they are read
+        return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitRegistryMessage:
         return ReceiveRegistryMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitProxyMessage:
         return ReceiveProxyMessage(from, std::move(buffer));
+    case VAsioMsgKind::SilKitCompressedMsg:
+        // Not reported by the SerializedMessage, compressed messages report the kind of the message they contain
+        _logger->Warn("Received message with VAsioMsgKind::SilKitCompressedMsg");
+        break;
     }
 }
 
@@ -1342,7 +1464,9 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         return;
     }
 
-    auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+    // Only the route is read here, the payload is either relayed as part of the received buffer, or deserialized if
+    // the message is addressed to us.
+    const auto proxyMessageRoute = buffer.PeekProxyMessageRoute();
 
     if (!_capabilities.HasProxyMessageCapability())
     {
@@ -1350,38 +1474,45 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         SilKit::Services::Logging::Warn(
             _logger, onceFlag,
             "Ignoring VAsioMsgKind::SilKitProxyMessage because feature is disabled via configuration: From {}, To {}",
-            proxyMessage.source, proxyMessage.destination);
+            proxyMessageRoute.source, proxyMessageRoute.destination);
         return;
     }
 
     SilKit::Services::Logging::Trace(_logger,
                                      "Received message with VAsioMsgKind::SilKitProxyMessage: From {}, To {}",
-                                     proxyMessage.source, proxyMessage.destination);
+                                     proxyMessageRoute.source, proxyMessageRoute.destination);
 
-    const bool fromIsSource = from->GetInfo().participantName == proxyMessage.source;
+    const bool fromIsSource = from->GetInfo().participantName == proxyMessageRoute.source;
     if (fromIsSource)
     {
-        auto peer{FindPeerByName(proxyMessage.destination)};
+        auto peer{FindPeerByName(proxyMessageRoute.destination)};
         if (peer == nullptr)
         {
             SilKit::Services::Logging::Error(_logger, "Unable to deliver proxy message from {} to {}",
-                                             proxyMessage.source, proxyMessage.destination);
+                                             proxyMessageRoute.source, proxyMessageRoute.destination);
             return;
         }
 
-        peer->SendSilKitMsg(SerializedMessage{proxyMessage});
-
         // We are relaying a message from source to destination and acting as a proxy. Record the association between
         // source and destination. This is used during disconnects, where we create empty ProxyMessages on behalf of
         // the disconnected peer, to inform the destination that the source peer has disconnected.
-        _proxySourceToDestinations[proxyMessage.source].insert(proxyMessage.destination);
+        // The association is recorded once for each pair of peers, not for every relayed message.
+        if (_proxyRelayedPeers[from].insert(peer).second)
+        {
+            _proxySourceToDestinations[proxyMessageRoute.source].insert(proxyMessageRoute.destination);
+        }
+
+        // The relayed message is identical to the received one, so the received buffer is passed on unchanged
+        peer->SendSilKitMsg(std::move(buffer));
 
         return;
     }
 
-    const bool isDestination = _participantName == proxyMessage.destination;
+    const bool isDestination = _participantName == proxyMessageRoute.destination;
     if (isDestination)
     {
+        auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+
         auto peer{FindPeerByName(proxyMessage.source)};
 
         if (peer == nullptr)
@@ -1498,6 +1629,35 @@ void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ack
     }
 }
 
+void VAsioConnection::ReceiveSubscriptionRemoval(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto removal = buffer.Deserialize<SubscriptionRemoval>();
+    RemoveRemoteSubscriber(from, removal.subscriber);
+}
+
+void VAsioConnection::RemoveRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber)
+{
+    tt::for_each(_links, [this, &from, &subscriber](auto&& linkMap) {
+        using LinkType = typename std::decay_t<decltype(linkMap)>::mapped_type::element_type;
+
+        if (subscriber.msgTypeName != LinkType::MessageSerdesName())
+            return;
+
+        std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+        auto link = linkMap.find(subscriber.networkName);
+        if (link == linkMap.end())
+            return;
+        auto linkPtr = link->second;
+        lock.unlock();
+
+        // remove the remote receiver without taking the lock
+        linkPtr->RemoveRemoteReceiver(from, subscriber.receiverIdx);
+    });
+
+    Services::Logging::Debug(_logger, "Messages of type '{}' on link '{}' will not be sent to participant '{}' anymore",
+                             subscriber.msgTypeName, subscriber.networkName, from->GetInfo().participantName);
+}
+
 bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber)
 {
     bool wasAdded = false;
@@ -1548,12 +1708,153 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
     }
 
     auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
+    auto remoteEndpoint = GetRemoteServiceEndpoint(from, endpoint.endpoint);
+
+    auto* receiver = _vasioReceivers[receiverIdx].get();
+
+    if (_ioWorkerPool == nullptr)
+    {
+        receiver->ReceiveRawMsg(*remoteEndpoint, std::move(buffer));
+        return;
+    }
+
+    // The peer itself must not be accessed by the workers, since it may be removed before the message is handled.
+    auto it = _ioWorkerPeerStates.find(from);
+    if (it == _ioWorkerPeerStates.end())
+    {
+        it = _ioWorkerPeerStates.emplace(from, std::make_shared<IoWorkerPeerState>()).first;
+    }
+
+    DeliverRawSilKitMessage(it->second,
+                            RawSilKitMessage{receiver, receiverIdx, std::move(remoteEndpoint), std::move(buffer)});
+}
+
+void VAsioConnection::DeliverRawSilKitMessage(const std::shared_ptr<IoWorkerPeerState>& state,
+                                              RawSilKitMessage&& message)
+{
+    if (state->waitingForWorkers)
+    {
+        state->deferredMessages.emplace_back(std::move(message));
+        return;
+    }
+
+    if (message.receiver->IsUserData())
+    {
+        // All user data on a network is handled by the same worker, which keeps its order and never invokes the
+        // handlers of a service concurrently
+        const auto workerIndex = GetIoWorkerIndex(message.receiver, message.receiverIdx);
+
+        ++state->pendingUserData;
+        _ioWorkerPool->Post(workerIndex, [this, state, message = std::move(message)]() mutable {
+            try
+            {
+                std::shared_lock<decltype(_ioWorkerDeliveryMutex)> lock{_ioWorkerDeliveryMutex};
+                message.receiver->ReceiveRawMsg(*message.remoteEndpoint, std::move(message.buffer));
+            }
+            catch (...)
+            {
+                OnUserDataDelivered(state);
+                throw;
+            }
+            OnUserDataDelivered(state);
+        });
+        return;
+    }
+
+    // Orchestration, lifecycle, discovery and all other system messages are delivered on the IO worker thread. They
+    // must not overtake user data of the same peer, which is still queued on the workers.
+    if (state->pendingUserData == 0)
+    {
+        ExecuteExclusiveOfIoWorkers([&message] {
+            message.receiver->ReceiveRawMsg(*message.remoteEndpoint, std::move(message.buffer));
+        });
+        return;
+    }
+
+    state->waitingForWorkers = true;
+    state->deferredMessages.emplace_back(std::move(message));
+
+    state->resumeRequested = true;
+    if (state->pendingUserData == 0 && state->resumeRequested.exchange(false))
+    {
+        // the workers delivered the pending user data in the meantime
+        ResumeDeferredRawSilKitMessages(state);
+    }
+}
+
+void VAsioConnection::OnUserDataDelivered(const std::shared_ptr<IoWorkerPeerState>& state)
+{
+    if (--state->pendingUserData == 0 && state->resumeRequested.exchange(false))
+    {
+        _ioContext->Post([this, state] { ResumeDeferredRawSilKitMessages(state); });
+    }
+}
+
+void VAsioConnection::ResumeDeferredRawSilKitMessages(const std::shared_ptr<IoWorkerPeerState>& state)
+{
+    state->waitingForWorkers = false;
+
+    auto deferredMessages = std::move(state->deferredMessages);
+    state->deferredMessages.clear();
+
+    while (!deferredMessages.empty())
+    {
+        auto message = std::move(deferredMessages.front());
+        deferredMessages.pop_front();
+
+        // defers the message again, if a system message has to wait for the workers once more
+        DeliverRawSilKitMessage(state, std::move(message));
+    }
+}
+
+auto VAsioConnection::GetIoWorkerIndex(IVAsioReceiver* receiver, size_t receiverIdx) -> size_t
+{
+    if (receiverIdx >= _ioWorkerIndexByReceiver.size())
+    {
+        _ioWorkerIndexByReceiver.resize(receiverIdx + 1, std::numeric_limits<size_t>::max());
+    }
+
+    auto& workerIndex = _ioWorkerIndexByReceiver[receiverIdx];
+    if (workerIndex == std::numeric_limits<size_t>::max())
+    {
+        // the networks are assigned to the workers round-robin, in the order they receive their first message
+        const auto& networkName = receiver->GetDescriptor().networkName;
+        auto it = _ioWorkerIndexByNetwork.find(networkName);
+        if (it == _ioWorkerIndexByNetwork.end())
+        {
+            it = _ioWorkerIndexByNetwork.emplace(networkName, _ioWorkerIndexByNetwork.size()).first;
+        }
+        workerIndex = it->second;
+    }
+
+    return workerIndex;
+}
+
+void VAsioConnection::ExecuteExclusiveOfIoWorkers(const std::function<void()>& function)
+{
+    if (_ioWorkerPool == nullptr)
+    {
+        function();
+        return;
+    }
+
+    std::unique_lock<decltype(_ioWorkerDeliveryMutex)> lock{_ioWorkerDeliveryMutex};
+    function();
+}
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+auto VAsioConnection::GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointId endpointId)
+    -> std::shared_ptr<const RemoteServiceEndpoint>
+{
+    auto& remoteServiceEndpoint = _remoteServiceEndpoints[from][endpointId];
+    if (remoteServiceEndpoint == nullptr)
+    {
+        auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
+        ServiceDescriptor descriptor(fromService->GetServiceDescriptor());
+        descriptor.SetServiceId(endpointId);
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+        remoteServiceEndpoint = std::make_shared<const RemoteServiceEndpoint>(std::move(descriptor));
+    }
+    return remoteServiceEndpoint;
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1631,7 +1932,7 @@ auto VAsioConnection::GetNumberOfRemoteReceivers(const IServiceEndpoint* service
     auto networkName = service->GetServiceDescriptor().GetNetworkName();
 
     size_t result = 0;
-    tt::for_each(_links, [this, &networkName, msgTypeName, &result](auto&& linkMap) {
+    tt::for_each(_links, [this, service, &networkName, msgTypeName, &result](auto&& linkMap) {
         using LinkPtr = typename std::decay_t<decltype(linkMap)>::mapped_type;
         using LinkType = typename LinkPtr::element_type;
 
@@ -1641,6 +1942,14 @@ auto VAsioConnection::GetNumberOfRemoteReceivers(const IServiceEndpoint* service
         if (msgTypeName != LinkType::MessageSerdesName())
             return;
 
+        // a sending service holds its resolved link, which does not require the lock
+        const auto senderLink = FindLinkOfSender<typename LinkType::MsgType>(service);
+        if (senderLink)
+        {
+            result = senderLink->GetNumberOfRemoteReceivers();
+            return;
+        }
+
         // access the link under lock
         std::unique_lock<decltype(_linksMx)> lock{_linksMx};
         auto& link = linkMap[networkName];
@@ -1660,7 +1969,7 @@ auto VAsioConnection::GetParticipantNamesOfRemoteReceivers(const IServiceEndpoin
     auto networkName = service->GetServiceDescriptor().GetNetworkName();
 
     std::vector<std::string> result{};
-    tt::for_each(_links, [this, &networkName, msgTypeName, &result](auto&& linkMap) {
+    tt::for_each(_links, [this, service, &networkName, msgTypeName, &result](auto&& linkMap) {
         using LinkPtr = typename std::decay_t<decltype(linkMap)>::mapped_type;
         using LinkType = typename LinkPtr::element_type;
 
@@ -1670,6 +1979,14 @@ auto VAsioConnection::GetParticipantNamesOfRemoteReceivers(const IServiceEndpoin
         if (msgTypeName != LinkType::MessageSerdesName())
             return;
 
+        // a sending service holds its resolved link, which does not require the lock
+        const auto senderLink = FindLinkOfSender<typename LinkType::MsgType>(service);
+        if (senderLink)
+        {
+            result = senderLink->GetParticipantNamesOfRemoteReceivers();
+            return;
+        }
+
         // access the link under lock
         std::unique_lock<decltype(_linksMx)> lock{_linksMx};
         auto& link = linkMap[networkName];
@@ -1697,6 +2014,22 @@ void VAsioConnection::AsyncSubscriptionsCompleted()
     _hasPendingAsyncSubscriptions = false;
 }
 
+bool VAsioConnection::PeerSupportsSubscription(const IVAsioPeer* peer, const VAsioMsgSubscriber& subscriber)
+{
+    // Participants of older versions reject subscriptions to message types they do not know. Message types which were
+    // added along with a capability are only subscribed at peers which announced it.
+    if (subscriber.msgTypeName == SilKitMsgTraits<Services::Logging::LogMsgBatch>::SerdesName())
+    {
+        return VAsioCapabilities{peer->GetInfo().capabilities}.HasCapability(Capabilities::LogMsgBatch);
+    }
+    return true;
+}
+
+bool VAsioConnection::PeerSupportsSubscriptionRemoval(const IVAsioPeer* peer)
+{
+    return VAsioCapabilities{peer->GetInfo().capabilities}.HasCapability(Capabilities::SubscriptionRemoval);
+}
+
 bool VAsioConnection::ParticipantHasCapability(const std::string& participantName, const std::string& capability) const
 {
     const auto peer{FindPeerByName(participantName)};
@@ -1727,7 +2060,19 @@ auto VAsioConnection::MakePeerInfo() -> VAsioPeerInfo
     {
         std::lock_guard<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
 
-        // Ensure that the local acceptors are the first entries in the acceptorUris
+        // Ensure that the shared-memory and local acceptors are the first entries in the acceptorUris
+        for (const auto& acceptor : _acceptors)
+        {
+            Uri uri{acceptor->GetLocalEndpoint()};
+
+            if (uri.Type() != Uri::UriType::SharedMemory)
+            {
+                continue;
+            }
+
+            peerInfo.acceptorUris.emplace_back(uri.EncodedString());
+        }
+
         for (const auto& acceptor : _acceptors)
         {
             Uri uri{acceptor->GetLocalEndpoint()};
@@ -1761,15 +2106,17 @@ auto VAsioConnection::MakePeerInfo() -> VAsioPeerInfo
 
 auto VAsioConnection::MakeConnectPeer(const VAsioPeerInfo& peerInfo) -> std::unique_ptr<IConnectPeer>
 {
-    auto connectPeer{
-        std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo, _config.middleware.enableDomainSockets)};
+    auto connectPeer{std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo,
+                                                   _config.middleware.enableDomainSockets,
+                                                   _config.middleware.enableSharedMemory)};
     return connectPeer;
 }
 
 
 auto VAsioConnection::MakeVAsioPeer(std::unique_ptr<IRawByteStream> stream) -> std::unique_ptr<IVAsioPeer>
 {
-    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger)};
+    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger,
+                                                 MakeVAsioPeerSettings(_config))};
     return vAsioPeer;
 }
 
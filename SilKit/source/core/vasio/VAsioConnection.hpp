@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -29,8 +30,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <typeinfo>
 #include <future>
 #include <mutex>
+#include <shared_mutex>
 #include <atomic>
 #include <list>
+#include <deque>
 #include <set>
 #include <condition_variable>
 
@@ -68,6 +71,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MakeAsioIoContext.hpp"
 #include "ConnectKnownParticipants.hpp"
 #include "RemoteConnectionManager.hpp"
+#include "IoWorkerPool.hpp"
 
 
 namespace SilKit {
@@ -143,6 +147,35 @@ public:
         }
     }
 
+    //! Let an already registered service also receive the messages sent on another network, e.g., an internal data
+    //! subscriber which receives the data of several publishers. The remote peers deliver these messages to the
+    //! receivers of the service's own network, no additional link or receiver is created. Only services with
+    //! asynchronous registration are supported.
+    template <class SilKitServiceT>
+    void RegisterSilKitServiceOnNetwork(SilKitServiceT* service, const std::string& networkName)
+    {
+        static_assert(SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration(),
+                      "only services with asynchronous registration can be registered on additional networks");
+
+        _hasPendingAsyncSubscriptions = true;
+
+        _ioContext->Post([this, service, networkName]() {
+            this->AddSubscriptionsOnNetwork<SilKitServiceT>(service, networkName);
+        });
+    }
+
+    //! Undo RegisterSilKitServiceOnNetwork: the service is removed from the local receivers of the network, and the
+    //! connected peers are asked to stop sending the messages of the network to it. Peers which connect afterwards are
+    //! not asked for them anymore. Peers without the "subscription-removal" capability keep the subscription until
+    //! they disconnect, their messages of the network are still delivered to the service.
+    template <class SilKitServiceT>
+    void UnregisterSilKitServiceFromNetwork(SilKitServiceT* service, const std::string& networkName)
+    {
+        _ioContext->Post([this, service, networkName]() {
+            this->RemoveSubscriptionsOnNetwork<SilKitServiceT>(service, networkName);
+        });
+    }
+
     template <class SilKitServiceT>
     void SetHistoryLengthForLink(size_t historyLength, SilKitServiceT* service)
     {
@@ -157,16 +190,60 @@ public:
         });
     }
 
+    //! Inform the link about a service of a remote participant on it, which allows the link to skip sending messages
+    //! the remote participant does not accept (see RemoteReceiverFilter)
+    template <class SilKitMessageT>
+    void AddRemoteServiceToLink(const std::string& networkName, const ServiceDescriptor& serviceDescriptor)
+    {
+        GetLinkByName<SilKitMessageT>(networkName)->AddRemoteService(serviceDescriptor);
+    }
+
+    template <class SilKitMessageT>
+    void RemoveRemoteServiceFromLink(const std::string& networkName, const ServiceDescriptor& serviceDescriptor)
+    {
+        GetLinkByName<SilKitMessageT>(networkName)->RemoveRemoteService(serviceDescriptor);
+    }
+
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+
+        auto link = GetLinkForSending<MessageT>(from);
+        if (!link)
+        {
+            return;
+        }
+
+        // Remote receivers are served from the calling thread, the message is serialized once and enqueued to the
+        // peers directly. Only the delivery to local receivers is deferred to the IO thread, which requires a copy.
+        link->DistributeLocalSilKitMessageToRemoteReceivers(from, msg);
+
+        if (link->HasLocalReceiversFor(from))
+        {
+            ExecuteOnIoThread([link, from, msg = MessageT(std::forward<SilKitMessageT>(msg))] {
+                link->DistributeLocalSilKitMessageToLocalReceivers(from, msg);
+            });
+        }
     }
 
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        auto link = GetLinkForSending<std::decay_t<SilKitMessageT>>(from);
+        if (!link)
+        {
+            return;
+        }
+
+        try
+        {
+            link->DispatchSilKitMessageToTarget(from, targetParticipantName, msg);
+        }
+        catch (const std::exception& error)
+        {
+            Services::Logging::Error(_logger, "SendMsg: {}", error.what());
+        }
     }
 
     inline void OnAllMessagesDelivered(const std::function<void()>& callback)
@@ -177,7 +254,9 @@ public:
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> function)
     {
-        _ioContext->Post(std::move(function));
+        _ioContext->Post([this, function = std::move(function)] {
+            ExecuteExclusiveOfIoWorkers(function);
+        });
     }
 
     inline auto Config() const -> const SilKit::Config::ParticipantConfiguration&
@@ -192,6 +271,7 @@ public:
     auto PrepareAcceptorEndpointUris(const std::string &connectUri) -> std::vector<std::string>;
     void OpenTcpAcceptors(const std::vector<std::string> & acceptorEndpointUris);
     void OpenLocalAcceptors(const std::vector<std::string> & acceptorEndpointUris);
+    void OpenSharedMemoryAcceptors(const std::vector<std::string>& acceptorEndpointUris);
 
     // Listening Sockets (acceptors)
     void AcceptLocalConnections(const std::string& uniqueId);
@@ -231,10 +311,46 @@ private: // data types
     template <class MsgT>
     using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
 
+    //! \brief Link handles resolved when a sending service is registered. A null handle marks a service endpoint which
+    //!        was registered on more than one network (e.g., a bus simulator) and must be resolved by name.
+    template <class MsgT>
+    using SilKitServiceToLinkHandleMap = std::unordered_map<const IServiceEndpoint*, std::shared_ptr<SilKitLink<MsgT>>>;
+
+    //! \brief Immutable snapshot of the link handles, which is replaced as a whole when a sending service is
+    //!        registered. Sending threads read it without taking the connection-wide links mutex.
+    template <class MsgT>
+    using SilKitServiceToLinkHandles = std::shared_ptr<const SilKitServiceToLinkHandleMap<MsgT>>;
+
     using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
+    //! \brief A received message, resolved to its receiver, which is waiting for its delivery.
+    struct RawSilKitMessage
+    {
+        IVAsioReceiver* receiver;
+        size_t receiverIdx;
+        std::shared_ptr<const RemoteServiceEndpoint> remoteEndpoint;
+        SerializedMessage buffer;
+    };
+
+    //! \brief Delivery state of a peer whose user data is handed to the additional IO workers. All other messages of
+    //!        the peer are delivered on the IO worker thread, after the user data received before them.
+    struct IoWorkerPeerState
+    {
+        //! User data messages posted to the workers, but not yet delivered
+        std::atomic<size_t> pendingUserData{0};
+        //! Set while the IO worker thread waits for the workers to deliver the pending user data (only accessed by the
+        //! IO worker thread)
+        bool waitingForWorkers{false};
+        //! Set by the IO worker thread when it starts waiting. Whoever resets it (the IO worker thread or the worker
+        //! delivering the last pending user data) resumes the deferred messages.
+        std::atomic<bool> resumeRequested{false};
+        //! Messages received while waiting for the workers (only accessed by the IO worker thread)
+        std::deque<RawSilKitMessage> deferredMessages;
+    };
+
     using SilKitMessageTypes = std::tuple<
         Services::Logging::LogMsg,
+        Services::Logging::LogMsgBatch,
         Services::Orchestration::NextSimTask,
         Services::Orchestration::SystemCommand,
         Services::Orchestration::ParticipantStatus,
@@ -283,12 +399,20 @@ private:
     // ----------------------------------------
     // private methods
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    void DeliverRawSilKitMessage(const std::shared_ptr<IoWorkerPeerState>& state, RawSilKitMessage&& message);
+    void ResumeDeferredRawSilKitMessages(const std::shared_ptr<IoWorkerPeerState>& state);
+    void OnUserDataDelivered(const std::shared_ptr<IoWorkerPeerState>& state);
+    auto GetIoWorkerIndex(IVAsioReceiver* receiver, size_t receiverIdx) -> size_t;
+    void ExecuteExclusiveOfIoWorkers(const std::function<void()>& function);
+    auto GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointId endpointId) -> std::shared_ptr<const RemoteServiceEndpoint>;
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionRemoval(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
 
     bool TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber);
+    void RemoveRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber);
 
     // Registry related send / receive methods
     void SendParticipantAnnouncement(IVAsioPeer* peer);
@@ -307,6 +431,10 @@ private:
     void LogAndPrintNetworkIncompatibility(const RegistryMsgHeader& other, const std::string& otherParticipantName);
 
     void AssociateParticipantNameAndPeer(const std::string& participantName, IVAsioPeer* peer);
+    //! False if the peer would reject the subscription, since it lacks the capability of the message type
+    static bool PeerSupportsSubscription(const IVAsioPeer* peer, const VAsioMsgSubscriber& subscriber);
+    //! False if the peer does not know the SubscriptionRemoval message and keeps its subscriptions until disconnecting
+    static bool PeerSupportsSubscriptionRemoval(const IVAsioPeer* peer);
     auto FindPeerByName(const std::string& name) const -> IVAsioPeer*;
 
     // Subscriptions completed Helper
@@ -368,6 +496,11 @@ private:
 
                 for (auto&& peer : _peers)
                 {
+                    if (!PeerSupportsSubscription(peer.get(), subscriptionInfo))
+                    {
+                        continue;
+                    }
+
                     // Add pending subscriptions
                     PendingAcksIdentifier ackPair{peer.get(), subscriptionInfo};
                     if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
@@ -386,11 +519,43 @@ private:
     }
 
     template<class SilKitMessageT>
-    void RegisterSilKitMsgSender(const std::string& networkName)
+    void RegisterSilKitMsgSender(const IServiceEndpoint* service, const std::string& networkName)
     {
         auto link = GetLinkByName<SilKitMessageT>(networkName);
+
+        std::unique_lock<decltype(_linksMx)> lock{_linksMx};
         auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
         serviceLinkMap[networkName] = link;
+
+        auto& linkHandles = std::get<SilKitServiceToLinkHandles<SilKitMessageT>>(_serviceToLinkHandles);
+        auto newLinkHandles = linkHandles ? std::make_shared<SilKitServiceToLinkHandleMap<SilKitMessageT>>(*linkHandles)
+                                          : std::make_shared<SilKitServiceToLinkHandleMap<SilKitMessageT>>();
+        auto result = newLinkHandles->emplace(service, link);
+        if (!result.second && result.first->second != link)
+        {
+            result.first->second = nullptr;
+        }
+        std::atomic_store(&linkHandles, SilKitServiceToLinkHandles<SilKitMessageT>{std::move(newLinkHandles)});
+    }
+
+    //! Lookup of the link resolved when the service was registered as a sender, without taking the links mutex.
+    //! Returns nullptr if the service is not registered as a sender, or registered on more than one network.
+    template <class SilKitMessageT>
+    auto FindLinkOfSender(const IServiceEndpoint* from) const -> std::shared_ptr<SilKitLink<SilKitMessageT>>
+    {
+        const auto linkHandles =
+            std::atomic_load(&std::get<SilKitServiceToLinkHandles<SilKitMessageT>>(_serviceToLinkHandles));
+        if (!linkHandles)
+        {
+            return nullptr;
+        }
+
+        auto handle = linkHandles->find(from);
+        if (handle == linkHandles->end())
+        {
+            return nullptr;
+        }
+        return handle->second;
     }
 
     template<class SilKitServiceT>
@@ -410,7 +575,8 @@ private:
             [this, service](auto&& message)
         {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service).GetNetworkName());
+            this->RegisterSilKitMsgSender<SilKitMessageT>(&dynamic_cast<const IServiceEndpoint&>(*service),
+                                                          GetServiceDescriptor(service).GetNetworkName());
         }
         );
 
@@ -432,33 +598,149 @@ private:
         }
     }
 
-    template <class SilKitMessageT>
-    void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
+    template <class SilKitServiceT>
+    void AddSubscriptionsOnNetwork(SilKitServiceT* service, const std::string& networkName)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
+        typename SilKitServiceT::SilKitReceiveMessagesTypes receiveMessageTypes{};
+
+        const auto& serviceNetworkName = GetServiceDescriptor(service).GetNetworkName();
+
+        Util::tuple_tools::for_each(receiveMessageTypes, [this, service, &serviceNetworkName, &networkName](auto&& message) {
+            using SilKitMessageT = std::decay_t<decltype(message)>;
+
+            // local senders deliver to the local receivers of their own link, which they registered before
+            {
+                std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+                auto& linkMap = std::get<SilKitLinkMap<SilKitMessageT>>(_links);
+                auto link = linkMap.find(networkName);
+                if (link != linkMap.end())
+                {
+                    link->second->AddLocalReceiver(service);
+                }
+            }
+
+            const std::string msgSerdesName = SilKitMsgTraits<SilKitMessageT>::SerdesName();
+            auto receiver = std::find_if(_vasioReceivers.begin(), _vasioReceivers.end(), [&](const auto& r) {
+                return r->GetDescriptor().networkName == serviceNetworkName
+                       && r->GetDescriptor().msgTypeName == msgSerdesName;
+            });
+            if (receiver == _vasioReceivers.end())
+            {
+                Services::Logging::Warn(_logger, "Cannot subscribe to messages of type '{}' on link '{}': no receiver on link '{}'",
+                                        msgSerdesName, networkName, serviceNetworkName);
+                return;
+            }
+
+            // the remote peers send the messages of the network to the index of the existing receiver
+            VAsioMsgSubscriber subscriptionInfo{(*receiver)->GetDescriptor()};
+            subscriptionInfo.networkName = networkName;
+
+            if (std::find(_additionalSubscriptions.begin(), _additionalSubscriptions.end(), subscriptionInfo)
+                != _additionalSubscriptions.end())
+            {
+                return;
+            }
+            _additionalSubscriptions.push_back(subscriptionInfo);
+
+            std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+            for (auto&& peer : _peers)
+            {
+                if (!PeerSupportsSubscription(peer.get(), subscriptionInfo))
+                {
+                    continue;
+                }
 
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+                _pendingAsyncSubscriptionAcknowledges.emplace_back(peer.get(), subscriptionInfo);
+                peer->Subscribe(subscriptionInfo);
+            }
+        });
+
+        if (_pendingAsyncSubscriptionAcknowledges.empty())
         {
-            throw SilKitError{ "SendMsgImpl: sending on empty link for " + key };
+            AsyncSubscriptionsCompleted();
         }
-        auto&& link = linkMap[key];
-        link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg));
+    }
+
+    template <class SilKitServiceT>
+    void RemoveSubscriptionsOnNetwork(SilKitServiceT* service, const std::string& networkName)
+    {
+        typename SilKitServiceT::SilKitReceiveMessagesTypes receiveMessageTypes{};
+
+        const auto& serviceNetworkName = GetServiceDescriptor(service).GetNetworkName();
+
+        Util::tuple_tools::for_each(receiveMessageTypes, [this, service, &serviceNetworkName, &networkName](auto&& message) {
+            using SilKitMessageT = std::decay_t<decltype(message)>;
+
+            {
+                std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+                auto& linkMap = std::get<SilKitLinkMap<SilKitMessageT>>(_links);
+                auto link = linkMap.find(networkName);
+                if (link != linkMap.end())
+                {
+                    link->second->RemoveLocalReceiver(service);
+                }
+            }
+
+            const std::string msgSerdesName = SilKitMsgTraits<SilKitMessageT>::SerdesName();
+            auto subscriptionInfo = std::find_if(_additionalSubscriptions.begin(), _additionalSubscriptions.end(),
+                                                 [&](const VAsioMsgSubscriber& subscriber) {
+                const auto& receiverDescriptor = _vasioReceivers[subscriber.receiverIdx]->GetDescriptor();
+                return subscriber.networkName == networkName && receiverDescriptor.networkName == serviceNetworkName
+                       && receiverDescriptor.msgTypeName == msgSerdesName;
+            });
+            if (subscriptionInfo == _additionalSubscriptions.end())
+            {
+                return;
+            }
+            const auto subscriptionRemoval = SubscriptionRemoval{*subscriptionInfo};
+            _additionalSubscriptions.erase(subscriptionInfo);
+
+            std::vector<PendingAcksIdentifier> ackIds;
+            {
+                std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+                for (auto&& peer : _peers)
+                {
+                    ackIds.emplace_back(peer.get(), subscriptionRemoval.subscriber);
+
+                    if (!PeerSupportsSubscriptionRemoval(peer.get()))
+                    {
+                        continue;
+                    }
+
+                    peer->SendSilKitMsg(SerializedMessage{peer->GetProtocolVersion(), subscriptionRemoval});
+                }
+            }
+
+            // an acknowledge which is still outstanding is not awaited anymore
+            for (const auto& ackId : ackIds)
+            {
+                RemovePendingSubscription(ackId);
+            }
+        });
     }
 
     template <class SilKitMessageT>
-    void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
-                                   SilKitMessageT&& msg)
+    auto GetLinkForSending(const IServiceEndpoint* from) -> std::shared_ptr<SilKitLink<SilKitMessageT>>
     {
+        auto link = FindLinkOfSender<SilKitMessageT>(from);
+        if (link)
+        {
+            return link;
+        }
+
+        std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+
         const auto& key = from->GetServiceDescriptor().GetNetworkName();
 
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+        auto& linkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
+        auto it = linkMap.find(key);
+        if (it == linkMap.end())
         {
-            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for " + key};
+            lock.unlock();
+            Services::Logging::Error(_logger, "SendMsg: sending on empty link for {}", key);
+            return nullptr;
         }
-        auto&& link = linkMap[key];
-        link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        return it->second;
     }
 
     template <typename... MethodArgs, typename... Args>
@@ -521,8 +803,12 @@ private:
     Util::tuple_tools::wrapped_tuple<SilKitLinkMap, SilKitMessageTypes> _links;
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
+    //! \brief Lookup for links by sending service, avoids hashing the network name and taking _linksMx on every send.
+    Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkHandles, SilKitMessageTypes> _serviceToLinkHandles;
 
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    //! Subscriptions of existing receivers to additional networks, see RegisterSilKitServiceOnNetwork
+    std::vector<VAsioMsgSubscriber> _additionalSubscriptions;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
 
     std::mutex _participantAnnouncementReceiversMutex;
@@ -538,6 +824,8 @@ private:
 
     std::unique_ptr<IVAsioPeer> _registry{nullptr};
     std::vector<std::unique_ptr<IVAsioPeer>> _peers;
+    //! Removed peers, which are destroyed once the writes dispatched to the IO context before their removal have run
+    std::vector<std::unique_ptr<IVAsioPeer>> _removedPeers;
 
     std::mutex _acceptorsMutex;
     std::vector<std::unique_ptr<IAcceptor>> _acceptors;
@@ -567,6 +855,25 @@ private:
     std::function<void()> _asyncSubscriptionsCompletionHandler;
     std::atomic<bool> _hasPendingAsyncSubscriptions{false};
 
+    // Additional workers which deliver received user data, if configured (only accessed by the IO worker thread). All
+    // receivers on the same network are served by the same worker, which keeps the callbacks of a service serialized.
+    std::unique_ptr<IoWorkerPool> _ioWorkerPool;
+    std::unordered_map<IVAsioPeer*, std::shared_ptr<IoWorkerPeerState>> _ioWorkerPeerStates;
+    std::unordered_map<std::string, size_t> _ioWorkerIndexByNetwork;
+    std::vector<size_t> _ioWorkerIndexByReceiver;
+    // Held shared by the workers while they deliver user data, and exclusively by the IO worker thread while it delivers
+    // system messages and executes deferred functions (e.g., the SimTask), which keeps them mutually exclusive. This is
+    // deliberate: with a single IO thread, no two callbacks of a participant ever ran concurrently, and applications
+    // share state between the simulation step handler, the lifecycle handlers and their data handlers without locking.
+    // System messages cannot be told apart by whether they reach user code, e.g., a NextSimTask of another participant
+    // may run the SimTask, so all of them are serialized with the user data.
+    std::shared_timed_mutex _ioWorkerDeliveryMutex;
+
+    // Interned remote service endpoints by peer and endpoint id (only accessed by the IO worker thread). Shared with the
+    // additional workers, which may still deliver messages after the peer was removed.
+    std::unordered_map<IVAsioPeer*, std::unordered_map<EndpointId, std::shared_ptr<const RemoteServiceEndpoint>>>
+        _remoteServiceEndpoints;
+
     // The worker thread should be the last members in this class. This ensures
     // that no callback is destroyed before the thread finishes.
     std::thread _ioWorker;
@@ -579,6 +886,8 @@ private:
 
     // Hold mapping from proxy source to all proxy destinations (used by registry for shutdown information)
     std::unordered_map<std::string, std::unordered_set<std::string>> _proxySourceToDestinations;
+    // Pairs of source and destination peers already recorded in _proxySourceToDestinations
+    std::unordered_map<IVAsioPeer*, std::unordered_set<IVAsioPeer*>> _proxyRelayedPeers;
 
     // Hold mapping from proxied peer to all proxy peers being served via the key.
     std::unordered_map<IVAsioPeer*, std::unordered_set<IVAsioPeer*>> _peerToProxyPeers;
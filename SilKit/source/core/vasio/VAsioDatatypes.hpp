@@ -69,6 +69,12 @@ struct SubscriptionAcknowledge
     VAsioMsgSubscriber subscriber;
 };
 
+//! Undoes an earlier SubscriptionAnnouncement, the receiver stops sending the messages of the subscriber's link to it
+struct SubscriptionRemoval
+{
+    VAsioMsgSubscriber subscriber;
+};
+
 struct ParticipantAnnouncement
 {
     RegistryMsgHeader messageHeader;
@@ -144,6 +150,14 @@ struct ProxyMessage
     std::vector<uint8_t> payload;
 };
 
+//! The leading fields of a ProxyMessage, which suffice to relay it without reading the payload.
+struct ProxyMessageRoute
+{
+    ProxyMessageHeader header{0};
+    std::string source;
+    std::string destination;
+};
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -34,6 +34,10 @@ enum class VAsioMsgKind: uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    SilKitCompactMwMsg = 7, // 3.1 with "compact-network-header" capability
+    SilKitCompactSimMsg = 8, // 3.1 with "compact-network-header" capability
+    SilKitCompressedMsg = 9, // 3.1 with "compression-lz" capability
+    SubscriptionRemoval = 10, // 3.1 with "subscription-removal" capability
 };
 
 } // namespace Core
@@ -21,13 +21,19 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeer.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <thread>
 
+#include "silkit/participant/exception.hpp"
+
 #include "ILogger.hpp"
 #include "VAsioMsgKind.hpp"
+#include "VAsioCapabilities.hpp"
 #include "VAsioConnection.hpp"
+#include "SerializedMessageTraits.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
 
@@ -44,15 +50,28 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 using namespace std::chrono_literals;
 
 
+namespace {
+
+constexpr size_t RECEIVE_BUFFER_MINIMUM_SIZE{4096};
+
+auto ElapsedNanoseconds(std::chrono::steady_clock::time_point start) -> int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+
 namespace SilKit {
 namespace Core {
 
 VAsioPeer::VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-                     Services::Logging::ILogger* logger)
+                     Services::Logging::ILogger* logger, VAsioPeerSettings settings)
     : _listener{listener}
     , _ioContext{ioContext}
     , _socket{std::move(stream)}
     , _logger{logger}
+    , _settings{settings}
 {
     _socket->SetListener(*this);
 }
@@ -84,6 +103,22 @@ auto VAsioPeer::GetInfo() const -> const VAsioPeerInfo&
 void VAsioPeer::SetInfo(VAsioPeerInfo peerInfo)
 {
     _info = std::move(peerInfo);
+
+    bool useCompactNetworkHeaders{false};
+    bool useCompression{false};
+    try
+    {
+        const VAsioCapabilities capabilities{_info.capabilities};
+        useCompactNetworkHeaders = capabilities.HasCapability(Capabilities::CompactNetworkHeader);
+        useCompression = capabilities.HasCapability(Capabilities::Compression);
+    }
+    catch (const std::exception& error)
+    {
+        Services::Logging::Warn(_logger, "VAsioPeer: Failed to parse capabilities of participant '{}': {}",
+                                _info.participantName, error.what());
+    }
+    _useCompactNetworkHeaders = useCompactNetworkHeaders;
+    _useCompression = useCompression && _settings.compressionThreshold > 0;
 }
 
 
@@ -102,16 +137,99 @@ void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
     // Prevent sending when shutting down
     if (!_isShuttingDown && _socket != nullptr)
     {
+        const bool mayCompress = _useCompression && IsMwOrSim(buffer.GetMessageKind());
+
+        if (_useCompactNetworkHeaders)
+        {
+            buffer.UseCompactNetworkHeaders();
+        }
+
+        if (mayCompress)
+        {
+            CompressIfSmaller(buffer);
+        }
+
+        auto storage = buffer.ReleaseStorageAndSharedBody();
+        SendBuffer sendBuffer{std::move(storage.first), std::move(storage.second), buffer.GetHeaderOffset()};
+
         std::unique_lock<std::mutex> lock{_sendingQueueMutex};
 
-        _sendingQueue.push_back(buffer.ReleaseStorage());
+        // If the queue is not empty, either a write is in progress, or StartAsyncWrite is already pending. Both take
+        // care of the newly queued message, which saves a round-trip through the IO context per message.
+        const bool wasEmpty = _sendingQueue.empty();
+
+        _sendingQueue.push_back(std::move(sendBuffer));
 
         lock.unlock();
 
-        _ioContext->Dispatch([this] {
-            StartAsyncWrite();
-        });
+        if (wasEmpty)
+        {
+            _ioContext->Dispatch([this] {
+                StartAsyncWrite();
+            });
+        }
+    }
+}
+
+void VAsioPeer::CompressIfSmaller(SerializedMessage& buffer)
+{
+    const auto messageSize = buffer.GetSize();
+    if (messageSize < _settings.compressionThreshold)
+    {
+        return;
+    }
+
+    // a shared body is compressed by the first peer which sends it, the others reuse the result
+    const auto start = std::chrono::steady_clock::now();
+
+    if (buffer.CompressBody())
+    {
+        _messagesCompressed += 1;
+        _bytesBeforeCompression += messageSize;
+        _bytesAfterCompression += buffer.GetSize();
+    }
+    else
+    {
+        _messagesIncompressible += 1;
+    }
+
+    _compressionNanoseconds += ElapsedNanoseconds(start);
+}
+
+auto VAsioPeer::GetCompressionStatistics() const -> VAsioPeerCompressionStatistics
+{
+    VAsioPeerCompressionStatistics statistics;
+    statistics.messagesCompressed = _messagesCompressed;
+    statistics.messagesIncompressible = _messagesIncompressible;
+    statistics.bytesBeforeCompression = _bytesBeforeCompression;
+    statistics.bytesAfterCompression = _bytesAfterCompression;
+    statistics.compressionTime = std::chrono::nanoseconds{_compressionNanoseconds};
+    statistics.messagesReceivedCompressed = _messagesReceivedCompressed;
+    return statistics;
+}
+
+void VAsioPeer::LogCompressionStatistics()
+{
+    const auto statistics = GetCompressionStatistics();
+    if (statistics.messagesCompressed == 0 && statistics.messagesIncompressible == 0
+        && statistics.messagesReceivedCompressed == 0)
+    {
+        return;
     }
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    const auto ratio = statistics.bytesAfterCompression == 0
+                           ? 1.0
+                           : static_cast<double>(statistics.bytesBeforeCompression)
+                                 / static_cast<double>(statistics.bytesAfterCompression);
+
+    Services::Logging::Debug(
+        _logger,
+        "VAsioPeer: Compression statistics for participant '{}': {} messages compressed from {} to {} bytes (ratio "
+        "{:.2f}), {} incompressible, {:.3f} ms spent compressing; {} compressed messages received",
+        _info.participantName, statistics.messagesCompressed, statistics.bytesBeforeCompression,
+        statistics.bytesAfterCompression, ratio, statistics.messagesIncompressible,
+        Milliseconds{statistics.compressionTime}.count(), statistics.messagesReceivedCompressed);
 }
 
 void VAsioPeer::StartAsyncWrite()
@@ -127,17 +245,47 @@ void VAsioPeer::StartAsyncWrite()
 
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
+    // drain up to sendBatchMaxMessages / sendBatchMaxBytes from the queue, but always take at least one message
+    size_t batchBytes{0};
+    _currentSendingBufferData.clear();
+    while (!_sendingQueue.empty())
+    {
+        const auto& front = _sendingQueue.front();
+        const auto frontBytes = front.Size();
+
+        if (!_currentSendingBufferData.empty()
+            && (_currentSendingBufferData.size() >= _settings.sendBatchMaxMessages
+                || batchBytes + frontBytes > _settings.sendBatchMaxBytes))
+        {
+            break;
+        }
+
+        batchBytes += frontBytes;
+        _currentSendingBufferData.emplace_back(std::move(_sendingQueue.front()));
+        _sendingQueue.pop_front();
+    }
     lock.unlock();
 
-    _currentSendingBuffer = ConstBuffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
+    // gather-write the network headers and the shared bodies without joining them
+    _currentSendingBuffers.clear();
+    for (const auto& sendBuffer : _currentSendingBufferData)
+    {
+        _currentSendingBuffers.emplace_back(sendBuffer.data.data() + sendBuffer.offset,
+                                            sendBuffer.data.size() - sendBuffer.offset);
+        if (sendBuffer.sharedBody)
+        {
+            _currentSendingBuffers.emplace_back(sendBuffer.sharedBody->data(), sendBuffer.sharedBody->size());
+        }
+    }
+    _currentSendingBufferIndex = 0;
+
     WriteSomeAsync();
 }
 
 void VAsioPeer::WriteSomeAsync()
 {
-    _socket->AsyncWriteSome(ConstBufferSequence{&_currentSendingBuffer, 1});
+    _socket->AsyncWriteSome(ConstBufferSequence{_currentSendingBuffers.data() + _currentSendingBufferIndex,
+                                                _currentSendingBuffers.size() - _currentSendingBufferIndex});
 }
 
 void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
@@ -151,7 +299,8 @@ void VAsioPeer::StartAsyncRead()
 {
     _currentMsgSize = 0u;
 
-    _msgBuffer.resize(4096);
+    _msgBuffer.resize(RECEIVE_BUFFER_MINIMUM_SIZE);
+    _rPos = {0u};
     _wPos = {0u};
 
     ReadSomeAsync();
@@ -170,68 +319,93 @@ void VAsioPeer::ReadSomeAsync()
 
 void VAsioPeer::DispatchBuffer()
 {
-    if (_currentMsgSize == 0)
+    // dispatch all complete messages in the receive buffer, without moving the trailing data after each one
+    while (!_isShuttingDown)
     {
-        if (_isShuttingDown)
+        const auto bytesAvailable = _wPos - _rPos;
+
+        if (_currentMsgSize == 0)
         {
-            return;
+            if (bytesAvailable < sizeof(uint32_t))
+            {
+                // not enough data to even determine the message size...
+                break;
+            }
+
+            uint32_t msgSize{0u};
+            memcpy(&msgSize, _msgBuffer.data() + _rPos, sizeof msgSize);
+            _currentMsgSize = msgSize;
+
+            // validate the received size
+            if (msgSize == 0 || msgSize > 1024 * 1024 * 1024)
+            {
+                SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", msgSize);
+                Shutdown();
+                return;
+            }
         }
-        if (_wPos >= sizeof(uint32_t))
+
+        const size_t msgSize{_currentMsgSize};
+        if (bytesAvailable < msgSize)
+        {
+            break;
+        }
+
+        std::vector<uint8_t> msgData;
+        if (_rPos == 0 && _wPos == msgSize)
         {
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(_msgBuffer.data());
+            // the buffer holds exactly this message, hand it over as a whole instead of copying it
+            _msgBuffer.resize(msgSize);
+            msgData = std::move(_msgBuffer);
+            _msgBuffer = std::vector<uint8_t>{};
         }
         else
         {
-            // not enough data to even determine the message size...
-            // make sure the buffer can store some data
-            if (_msgBuffer.size() < sizeof(uint32_t))
-                _msgBuffer.resize(4096);
-            // and restart the async read operation
-            ReadSomeAsync();
-            return;
+            const auto msgBegin = _msgBuffer.cbegin() + static_cast<std::ptrdiff_t>(_rPos);
+            msgData.assign(msgBegin, msgBegin + static_cast<std::ptrdiff_t>(msgSize));
         }
-    }
-
-    // validate the received size
-    if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
-    {
-        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
-        Shutdown();
-    }
-
 
-    if (_wPos < _currentMsgSize)
-    {
-        // Make the buffer large enough and wait until we have more data.
-        _msgBuffer.resize(_currentMsgSize);
-        ReadSomeAsync();
-        return;
-    }
-    else
-    {
-        auto newBuffer = std::vector<uint8_t>{_msgBuffer.begin() + _currentMsgSize, _msgBuffer.end()};
-        auto newWPos = _wPos - _currentMsgSize;
+        _rPos += msgSize;
+        if (_rPos == _wPos)
+        {
+            _rPos = 0u;
+            _wPos = 0u;
+        }
+        _currentMsgSize = 0u;
 
-        // manually extract the message size so we can adjust the MessageBuffer size
-        uint32_t msgSize{0u};
-        if (_msgBuffer.size() < sizeof msgSize)
+        // compressed bodies are decompressed when the message is delivered, not on the IO thread
+        if (msgData.size() > sizeof(uint32_t)
+            && static_cast<VAsioMsgKind>(msgData[sizeof(uint32_t)]) == VAsioMsgKind::SilKitCompressedMsg)
         {
-            throw SilKitError{ "DispatchBuffer: Received message is too small to contain message size header" };
+            _messagesReceivedCompressed += 1;
         }
-        memcpy(&msgSize, _msgBuffer.data(), sizeof msgSize);
-        //ensure buffer does not contain data from contiguous messages
-        _msgBuffer.resize(msgSize);
-        SerializedMessage message{std::move(_msgBuffer)};
+
+        SerializedMessage message{std::move(msgData)};
         message.SetProtocolVersion(GetProtocolVersion());
         _listener->OnSocketData(this, std::move(message));
+    }
 
-        // keep trailing data in the buffer
-        _msgBuffer = std::move(newBuffer);
-        _wPos = newWPos;
-        _currentMsgSize = 0u;
+    if (_isShuttingDown)
+    {
+        return;
+    }
+
+    // move the (partial) trailing message to the front of the buffer, this happens at most once per read
+    if (_rPos != 0)
+    {
+        memmove(_msgBuffer.data(), _msgBuffer.data() + _rPos, _wPos - _rPos);
+        _wPos -= _rPos;
+        _rPos = 0u;
+    }
 
-        DispatchBuffer();
+    // make the buffer large enough for the current message and wait until we have more data
+    const auto requiredSize = std::max<size_t>(_currentMsgSize, RECEIVE_BUFFER_MINIMUM_SIZE);
+    if (_msgBuffer.size() < requiredSize)
+    {
+        _msgBuffer.resize(requiredSize);
     }
+
+    ReadSomeAsync();
 }
 
 
@@ -253,13 +427,27 @@ void VAsioPeer::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransfe
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    if (bytesTransferred < _currentSendingBuffer.GetSize())
+    // skip the buffers which were written completely, and slice off the written prefix of a partially written one
+    while (bytesTransferred > 0 && _currentSendingBufferIndex < _currentSendingBuffers.size())
+    {
+        auto& currentBuffer = _currentSendingBuffers[_currentSendingBufferIndex];
+        if (bytesTransferred < currentBuffer.GetSize())
+        {
+            currentBuffer.SliceOff(bytesTransferred);
+            break;
+        }
+
+        bytesTransferred -= currentBuffer.GetSize();
+        ++_currentSendingBufferIndex;
+    }
+
+    if (_currentSendingBufferIndex < _currentSendingBuffers.size())
     {
-        _currentSendingBuffer.SliceOff(bytesTransferred);
         WriteSomeAsync();
         return;
     }
 
+    _currentSendingBufferData.clear();
     _sending = false;
     StartAsyncWrite();
 }
@@ -270,6 +458,8 @@ void VAsioPeer::OnShutdown(IRawByteStream& stream)
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&stream));
 
+    LogCompressionStatistics();
+
     _listener->OnPeerShutdown(this);
 }
 
@@ -22,6 +22,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -43,6 +46,35 @@ namespace SilKit {
 namespace Core {
 
 
+struct VAsioPeerSettings
+{
+    //! Maximum number of queued messages which are combined into a single write operation.
+    size_t sendBatchMaxMessages{1};
+    //! Maximum number of bytes which are combined into a single write operation. The first queued message is always
+    //! sent, even if it exceeds this limit.
+    size_t sendBatchMaxBytes{64 * 1024};
+    //! Messages of at least this many bytes are sent compressed, if the peer announced Capabilities::Compression.
+    //! Zero disables the compression.
+    size_t compressionThreshold{0};
+};
+
+struct VAsioPeerCompressionStatistics
+{
+    //! Number of messages sent compressed
+    uint64_t messagesCompressed{0};
+    //! Number of messages which were not sent compressed, because the compression did not make them smaller
+    uint64_t messagesIncompressible{0};
+    //! Number of bytes of the compressed messages before the compression
+    uint64_t bytesBeforeCompression{0};
+    //! Number of bytes of the compressed messages after the compression
+    uint64_t bytesAfterCompression{0};
+    //! Time spent compressing messages, including the incompressible ones
+    std::chrono::nanoseconds compressionTime{0};
+    //! Number of received compressed messages, which are decompressed when they are delivered
+    uint64_t messagesReceivedCompressed{0};
+};
+
+
 class VAsioPeer
     : public IVAsioPeer
     , private IRawByteStreamListener
@@ -62,7 +94,7 @@ public:
     VAsioPeer& operator=(VAsioPeer&& other) = delete; //implicitly deleted because of mutex
 
     VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-              Services::Logging::ILogger* logger);
+              Services::Logging::ILogger* logger, VAsioPeerSettings settings);
 
     ~VAsioPeer() override;
 
@@ -86,9 +118,27 @@ public:
 
     inline void SetProtocolVersion(ProtocolVersion v)  override;
     inline auto GetProtocolVersion() const -> ProtocolVersion  override;
+    inline auto GetCompressionThreshold() const -> size_t override;
 
     void Shutdown() override;
 
+    auto GetCompressionStatistics() const -> VAsioPeerCompressionStatistics;
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+
+    //! A serialized message, possibly split into its network headers and a body shared with other peers
+    struct SendBuffer
+    {
+        std::vector<uint8_t> data;
+        std::shared_ptr<const std::vector<uint8_t>> sharedBody;
+        //! Bytes at the front of data which are not sent
+        size_t offset{0};
+
+        auto Size() const -> size_t { return data.size() - offset + (sharedBody ? sharedBody->size() : 0u); }
+    };
+
 private:
     // ----------------------------------------
     // Private Methods
@@ -96,6 +146,8 @@ private:
     void WriteSomeAsync();
     void ReadSomeAsync();
     void DispatchBuffer();
+    void CompressIfSmaller(SerializedMessage& buffer);
+    void LogCompressionStatistics();
 
 private: // IRawByteStreamListener
     void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
@@ -112,20 +164,35 @@ private:
     VAsioPeerInfo _info;
 
     Services::Logging::ILogger* _logger;
+    VAsioPeerSettings _settings;
 
     std::atomic_bool _isShuttingDown{false};
-
-    // receiving
+    //! The peer announced the Capabilities::CompactNetworkHeader, sim messages are sent with compact network headers
+    std::atomic_bool _useCompactNetworkHeaders{false};
+    //! The peer announced the Capabilities::Compression and compressionThreshold is set, large messages are compressed
+    std::atomic_bool _useCompression{false};
+
+    // compression statistics
+    std::atomic<uint64_t> _messagesCompressed{0};
+    std::atomic<uint64_t> _messagesIncompressible{0};
+    std::atomic<uint64_t> _bytesBeforeCompression{0};
+    std::atomic<uint64_t> _bytesAfterCompression{0};
+    std::atomic<int64_t> _compressionNanoseconds{0};
+    std::atomic<uint64_t> _messagesReceivedCompressed{0};
+
+    // receiving: _msgBuffer is reused across reads, complete messages are dispatched from [_rPos, _wPos)
     std::atomic<uint32_t> _currentMsgSize{0u};
     std::vector<uint8_t> _msgBuffer;
+    size_t _rPos{0};
     size_t _wPos{0};
     MutableBuffer _currentReceivingBuffer;
 
     // sending
     mutable std::mutex _sendingQueueMutex;
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    ConstBuffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
+    std::deque<SendBuffer> _sendingQueue;
+    std::vector<SendBuffer> _currentSendingBufferData;
+    std::vector<ConstBuffer> _currentSendingBuffers;
+    size_t _currentSendingBufferIndex{0};
 
     std::atomic_bool _sending{false};
     Core::ServiceDescriptor _serviceDescriptor;
@@ -154,6 +221,11 @@ auto VAsioPeer::GetProtocolVersion() const -> ProtocolVersion
     return _protocolVersion;
 }
 
+auto VAsioPeer::GetCompressionThreshold() const -> size_t
+{
+    return _useCompression ? _settings.compressionThreshold : 0;
+}
+
 
 } // namespace Core
 } // namespace SilKit
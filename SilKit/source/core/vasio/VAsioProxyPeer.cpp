@@ -111,6 +111,12 @@ auto VAsioProxyPeer::GetProtocolVersion() const -> ProtocolVersion
     return _protocolVersion;
 }
 
+auto VAsioProxyPeer::GetCompressionThreshold() const -> size_t
+{
+    // the message is wrapped into a ProxyMessage, which the peer of the proxy compresses as a whole
+    return 0;
+}
+
 // ================================================================================
 //  IServiceEndpoint via IVAsioConnectionPeer
 // ================================================================================
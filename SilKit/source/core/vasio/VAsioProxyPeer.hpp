@@ -57,6 +57,7 @@ public: // IVAsioPeer
     void Shutdown() override;
     void SetProtocolVersion(ProtocolVersion v) override;
     auto GetProtocolVersion() const -> ProtocolVersion override;
+    auto GetCompressionThreshold() const -> size_t override;
 
 public: // IVAsioPeer (IServiceEndpoint)
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override;
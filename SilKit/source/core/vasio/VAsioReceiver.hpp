@@ -44,9 +44,9 @@ struct RemoteServiceEndpoint : IServiceEndpoint
         return _serviceDescriptor; 
     }
 
-    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
+    RemoteServiceEndpoint(ServiceDescriptor descriptor)
+        : _serviceDescriptor{std::move(descriptor)}
     {
-        _serviceDescriptor = descriptor;
     }
 
 private:
@@ -62,7 +62,9 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(const IServiceEndpoint& remoteEndpoint, SerializedMessage&& buffer) = 0;
+    //! User data may be delivered by the additional IO workers, all other messages are delivered on the IO thread.
+    virtual auto IsUserData() const -> bool = 0;
 };
 
 template <class MsgT>
@@ -79,7 +81,11 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(const IServiceEndpoint& remoteEndpoint, SerializedMessage&& buffer) override;
+    auto IsUserData() const -> bool override
+    {
+        return SilKitMsgTraits<MsgT>::IsUserData();
+    }
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -117,15 +123,13 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor, SerializedMessage&& buffer)
+void VAsioReceiver<MsgT>::ReceiveRawMsg(const IServiceEndpoint& remoteEndpoint, SerializedMessage&& buffer)
 {
     MsgT msg = buffer.Deserialize<MsgT>();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
-
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    Services::TraceRx(_logger, this, msg, remoteEndpoint.GetServiceDescriptor());
 
+    _link->DistributeRemoteSilKitMessage(&remoteEndpoint, std::move(msg));
 }
 
 } // namespace Core
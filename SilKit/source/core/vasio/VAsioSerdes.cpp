@@ -103,6 +103,18 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledge&
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionRemoval& removal)
+{
+    buffer << removal.subscriber;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionRemoval& removal)
+{
+    buffer >> removal.subscriber;
+    return buffer;
+}
+
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const ParticipantAnnouncement& announcement)
 {
     // ParticipantAnnouncement is the first message sent during a handshake.
@@ -336,6 +348,16 @@ auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader
     return header;
 }
 
+auto PeekProxyMessageRoute(MessageBuffer& buffer) -> ProxyMessageRoute
+{
+    MessageBufferPeeker peeker{buffer};
+
+    // The route shares its wire format with the leading fields of the ProxyMessage
+    ProxyMessageRoute route{};
+    buffer >> route.header >> route.source >> route.destination;
+    return route;
+}
+
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader
 {
     // NB: At the moment using the MessageBufferPeeker here -although correct- leads to an issue in the
@@ -371,6 +393,37 @@ auto ExtractEndpointAddress(MessageBuffer& buffer) -> EndpointAddress
     return endpointAddress;
 }
 
+void WriteCompactEndpointId(MessageBuffer& buffer, EndpointId endpointId)
+{
+    while (endpointId >= 0x80)
+    {
+        buffer << static_cast<uint8_t>((endpointId & 0x7f) | 0x80);
+        endpointId >>= 7;
+    }
+    buffer << static_cast<uint8_t>(endpointId);
+}
+
+auto ExtractCompactEndpointId(MessageBuffer& buffer) -> EndpointId
+{
+    EndpointId endpointId{0};
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t byte{0};
+        buffer >> byte;
+        // The 10th byte only carries the most significant bit, anything above it would be silently shifted out
+        if (shift == 63 && (byte & 0x7e) != 0)
+        {
+            throw SilKit::ProtocolError{"Compact endpoint id exceeds 64 bits"};
+        }
+        endpointId |= static_cast<EndpointId>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return endpointId;
+        }
+    }
+    throw SilKit::ProtocolError{"Compact endpoint id exceeds 64 bits"};
+}
+
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& msg)
 {
     buffer << msg;
@@ -408,6 +461,15 @@ void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledge& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const SubscriptionRemoval& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionRemoval& out)
+{
+    buffer >> out;
+}
+
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg)
 {
     buffer << msg;
@@ -42,16 +42,22 @@ auto ExtractRegistryMessageKind(MessageBuffer& buffer) -> RegistryMessageKind;
 
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader;
 auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader;
+auto PeekProxyMessageRoute(MessageBuffer& buffer) -> ProxyMessageRoute;
 
 auto ExtractEndpointId(MessageBuffer& buffer) ->EndpointId;
 auto ExtractEndpointAddress(MessageBuffer& buffer) ->EndpointAddress;
 
+// Compact network headers encode endpoint ids as variable-length integers (7 bits per byte, least significant first)
+void WriteCompactEndpointId(MessageBuffer& buffer, EndpointId endpointId);
+auto ExtractCompactEndpointId(MessageBuffer& buffer) -> EndpointId;
+
 //! Handshake: Serialize ParticipantAnnouncementReply (contains remote peer's protocol version)
 //  VAsioMsgKind: SilKitRegistryMessage
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncement& announcement);
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& reply);
 void Serialize(MessageBuffer& buffer, const VAsioMsgSubscriber& subscriber);
 void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledge& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionRemoval& msg);
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg);
 void Serialize(MessageBuffer& buffer, const ProxyMessage& msg);
 void Serialize(MessageBuffer& buffer, const RemoteParticipantConnectRequest& msg);
@@ -60,6 +66,7 @@ void Deserialize(MessageBuffer& buffer, ParticipantAnnouncement& out);
 void Deserialize(MessageBuffer& buffer,ParticipantAnnouncementReply& out);
 void Deserialize(MessageBuffer&, VAsioMsgSubscriber&);
 void Deserialize(MessageBuffer&, SubscriptionAcknowledge&);
+void Deserialize(MessageBuffer&, SubscriptionRemoval&);
 void Deserialize(MessageBuffer& buffer,KnownParticipants& out);
 void Deserialize(MessageBuffer& buffer, ProxyMessage& out);
 void Deserialize(MessageBuffer& buffer, RemoteParticipantConnectRequest& out);
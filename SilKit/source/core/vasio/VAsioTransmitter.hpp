@@ -21,7 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 #include "IVAsioPeer.hpp"
 #include <type_traits>
@@ -31,6 +34,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "traits/SilKitMsgTraits.hpp"
 
 #include "SerializedMessage.hpp"
+#include "ServiceConfigKeys.hpp"
+#include "WireCanMessages.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -77,6 +82,84 @@ private:
     bool _hasHistory{true};
 };
 
+// RemoteReceiverFilter: decides if a message is sent to a remote peer, based on the services of the peer which receive
+// the messages of the link. The generic filter sends all messages to all peers.
+template <typename MsgT>
+struct RemoteReceiverFilter
+{
+    void AddRemoteService(const ServiceDescriptor&) {}
+    void RemoveRemoteService(const ServiceDescriptor&) {}
+    bool Accepts(const IVAsioPeer*, const MsgT&) const { return true; }
+};
+// RemoteReceiverFilter<WireCanFrameEvent>: skip peers whose CAN controllers all reject the CAN identifier
+template <>
+struct RemoteReceiverFilter<Services::Can::WireCanFrameEvent>
+{
+    void AddRemoteService(const ServiceDescriptor& serviceDescriptor)
+    {
+        // Only CAN controllers are added by the participant. Controllers without acceptance filters receive all
+        // frames, which is represented by an empty list of filters
+        std::vector<Services::Can::CanAcceptanceFilter> filters;
+
+        std::string controllerType;
+        std::string filtersString;
+        if (serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType)
+            && controllerType == Discovery::controllerTypeCan
+            && serviceDescriptor.GetSupplementalDataItem(Discovery::supplKeyCanControllerAcceptanceFilters,
+                                                         filtersString))
+        {
+            filters = Services::Can::ParseCanAcceptanceFilters(filtersString);
+        }
+
+        _filtersByParticipant[serviceDescriptor.GetParticipantId()][serviceDescriptor.GetServiceId()] =
+            std::move(filters);
+    }
+
+    void RemoveRemoteService(const ServiceDescriptor& serviceDescriptor)
+    {
+        auto it = _filtersByParticipant.find(serviceDescriptor.GetParticipantId());
+        if (it == _filtersByParticipant.end())
+        {
+            return;
+        }
+
+        it->second.erase(serviceDescriptor.GetServiceId());
+        if (it->second.empty())
+        {
+            _filtersByParticipant.erase(it);
+        }
+    }
+
+    bool Accepts(const IVAsioPeer* peer, const Services::Can::WireCanFrameEvent& msg) const
+    {
+        // Like in the CAN controller, the acceptance filters only apply to received frames
+        if (msg.direction != Services::TransmitDirection::RX)
+        {
+            return true;
+        }
+
+        // Peers without known services are not filtered, e.g., if the frame is sent before the discovery completed
+        auto it = _filtersByParticipant.find(peer->GetInfo().participantId);
+        if (it == _filtersByParticipant.end())
+        {
+            return true;
+        }
+
+        for (const auto& service : it->second)
+        {
+            if (Services::Can::AcceptsCanId(service.second, msg.frame.canId, msg.frame.flags))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::unordered_map<ParticipantId, std::unordered_map<EndpointId, std::vector<Services::Can::CanAcceptanceFilter>>>
+        _filtersByParticipant;
+};
+
 
 struct RemoteReceiver {
     IVAsioPeer* peer;
@@ -90,11 +173,14 @@ class VAsioTransmitter
 {
     using History = MessageHistory<MsgT, SilKitMsgTraits<MsgT>::HistSize()>;
     History _hist;
+    RemoteReceiverFilter<MsgT> _receiverFilter;
 public:
     // ----------------------------------------
     // Public methods
     void AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx)
     {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
         RemoteReceiver remoteReceiver;
         remoteReceiver.peer = peer;
         remoteReceiver.remoteIdx = remoteIdx;
@@ -110,6 +196,8 @@ public:
 
     void RemoveRemoteReceiver(IVAsioPeer* peer)
     {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
         auto it = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [peer](auto&& remoteReceiver) {
             auto localPeerInfo = remoteReceiver.peer->GetInfo();
             auto peerToRemove = peer->GetInfo();
@@ -118,16 +206,37 @@ public:
         if (it != _remoteReceivers.end())
         {
             _remoteReceivers.erase(it);
+            ++_remoteReceiverRemovals;
+        }
+    }
+
+    //! Remove a single subscription of the peer, e.g., when it sent a SubscriptionRemoval
+    void RemoveRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx)
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+        RemoteReceiver remoteReceiver;
+        remoteReceiver.peer = peer;
+        remoteReceiver.remoteIdx = remoteIdx;
+
+        auto it = std::find(_remoteReceivers.begin(), _remoteReceivers.end(), remoteReceiver);
+        if (it != _remoteReceivers.end())
+        {
+            _remoteReceivers.erase(it);
+            ++_remoteReceiverRemovals;
         }
     }
 
     size_t GetNumberOfRemoteReceivers()
     { 
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
         return _remoteReceivers.size();
     }
 
     std::vector<std::string> GetParticipantNamesOfRemoteReceivers() 
     {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
         std::vector<std::string> participantNames{};
         for (auto it = _remoteReceivers.begin(); it != _remoteReceivers.end(); ++it)
         {
@@ -138,6 +247,11 @@ public:
 
     void SendMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg)
     {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        // Do not overtake the messages which are saved in the history, but not enqueued yet
+        _turnChanged.wait(lock, [this] { return _currentTurn == _nextTurn; });
+
         _hist.Save(from, msg);
         auto&& receiverIter = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [targetParticipantName](auto&& receiver) 
             {
@@ -157,20 +271,108 @@ public:
 
     void SetHistoryLength(size_t historyLength)
     {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
         _hist.SetHistoryLength(historyLength);
     }
 
+    //! Announce a service of a remote participant on this link, which might restrict the messages sent to the peer
+    void AddRemoteService(const ServiceDescriptor& serviceDescriptor)
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _receiverFilter.AddRemoteService(serviceDescriptor);
+    }
+
+    void RemoveRemoteService(const ServiceDescriptor& serviceDescriptor)
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _receiverFilter.RemoveRemoteService(serviceDescriptor);
+    }
+
 public:
     // ----------------------------------------
     // Public interface methods
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
-        _hist.Save(from, msg);
-        for (auto& receiver : _remoteReceivers)
+        // Messages are sent from the threads of the senders, while the remote receivers change on the IO thread. The
+        // lock ensures that a peer is not removed from the link while a message is enqueued to it. A removed peer is
+        // only destroyed after the writes dispatched to the IO context before its removal have run, so the peers must
+        // not be accessed outside of the lock.
+        //
+        // The message is serialized and compressed between the two critical sections. To keep the messages on the wire
+        // in the order in which they are saved in the history (and replayed to peers added meanwhile), each message
+        // takes a turn when it is saved and is only enqueued when its turn has come.
+        std::vector<RemoteReceiver> receivers;
+        size_t compressionThreshold{0};
+        uint64_t remoteReceiverRemovals{0};
+        uint64_t turn{0};
         {
-            auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
+            std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+            _hist.Save(from, msg);
+            for (const auto& receiver : _remoteReceivers)
+            {
+                if (!_receiverFilter.Accepts(receiver.peer, msg))
+                {
+                    continue;
+                }
+
+                const auto peerCompressionThreshold = receiver.peer->GetCompressionThreshold();
+                if (peerCompressionThreshold > 0
+                    && (compressionThreshold == 0 || peerCompressionThreshold < compressionThreshold))
+                {
+                    compressionThreshold = peerCompressionThreshold;
+                }
+                receivers.push_back(receiver);
+            }
+            remoteReceiverRemovals = _remoteReceiverRemovals;
+
+            // The receivers filter the messages, so there might be nothing to serialize and nothing to order
+            if (receivers.empty())
+            {
+                return;
+            }
+
+            turn = _nextTurn++;
+        }
+
+        // The body is identical for all receivers, only the remote index in the network headers differs. It is serialized
+        // and, if a receiver compresses it, compressed once without holding the lock.
+        SharedMessageBody body;
+        try
+        {
+            body = MakeSharedMessageBody(msg);
+            if (compressionThreshold > 0 && body.data->size() >= compressionThreshold)
+            {
+                CompressSharedMessageBody(body);
+            }
+        }
+        catch (...)
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _turnChanged.wait(lock, [this, turn] { return _currentTurn == turn; });
+            EndTurn();
+            throw;
+        }
+
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
+
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _turnChanged.wait(lock, [this, turn] { return _currentTurn == turn; });
+
+        const bool receiversRemoved = remoteReceiverRemovals != _remoteReceiverRemovals;
+        for (const auto& receiver : receivers)
+        {
+            if (receiversRemoved
+                && std::find(_remoteReceivers.begin(), _remoteReceivers.end(), receiver) == _remoteReceivers.end())
+            {
+                continue;
+            }
+
+            auto buffer = SerializedMessage(body, endpointAddress, receiver.remoteIdx);
             receiver.peer->SendSilKitMsg(std::move(buffer));
         }
+
+        EndTurn();
     }
 
     // IServiceEndpoint
@@ -182,10 +384,26 @@ public:
     {
         return _serviceDescriptor;
     }
+private:
+    // ----------------------------------------
+    // private methods
+    void EndTurn()
+    {
+        ++_currentTurn;
+        _turnChanged.notify_all();
+    }
+
 private:
     // ----------------------------------------
     // private members
+    mutable std::mutex _mutex;
+    //! Turns of the messages which are saved in the history, the message of the current turn is enqueued next
+    uint64_t _nextTurn{0};
+    uint64_t _currentTurn{0};
+    std::condition_variable _turnChanged;
     std::vector<RemoteReceiver> _remoteReceivers;
+    //! Counts the removed remote receivers, so ReceiveMsg only searches for them if one was removed meanwhile
+    uint64_t _remoteReceiverRemovals{0};
     ServiceDescriptor _serviceDescriptor;
 };
 
@@ -38,6 +38,10 @@ struct IIoContext
 
     virtual auto MakeLocalConnector(const std::string& path) -> std::unique_ptr<IConnector> = 0;
 
+    virtual auto MakeSharedMemoryAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> = 0;
+
+    virtual auto MakeSharedMemoryConnector(const std::string& path) -> std::unique_ptr<IConnector> = 0;
+
     virtual auto MakeTimer() -> std::unique_ptr<ITimer> = 0;
 
     virtual auto Resolve(const std::string& name) -> std::vector<std::string> = 0;
@@ -439,4 +439,29 @@ TEST_F(Test_IoContext_AcceptorConnector_PingPong, local_domain)
     ioContext->Run();
 }
 
+#if !defined(_WIN32)
+TEST_F(Test_IoContext_AcceptorConnector_PingPong, shared_memory)
+{
+    SetupExpectations();
+
+    auto ioContext = VSilKit::MakeAsioIoContext({});
+    ioContext->SetLogger(logger);
+
+    auto acceptor = ioContext->MakeSharedMemoryAcceptor(acceptorLocalDomainSocketPath);
+    acceptor->SetListener(acceptorListener);
+    acceptor->AsyncAccept(5000ms);
+
+    auto endpoint = acceptor->GetLocalEndpoint();
+    auto uri = Uri::Parse(endpoint);
+
+    ASSERT_EQ(uri.Type(), Uri::UriType::SharedMemory);
+
+    auto connector = ioContext->MakeSharedMemoryConnector(uri.Path());
+    connector->SetListener(connectorListener);
+    connector->AsyncConnect(0ms);
+
+    ioContext->Run();
+}
+#endif
+
 } // namespace
\ No newline at end of file
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "impl/SharedMemoryRawByteStream.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockLogger.hpp"
+#include "MockRawByteStream.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::ConstBuffer;
+using VSilKit::ConstBufferSequence;
+using VSilKit::IRawByteStreamListener;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+using VSilKit::MockRawByteStreamListener;
+using VSilKit::SharedMemoryRawByteStream;
+
+
+constexpr size_t RingCapacity{1024};
+
+
+struct Test_SharedMemoryRawByteStream : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    MockRawByteStreamListener listener;
+
+    NiceMock<MockRawByteStream>* doorbell{nullptr};
+    IRawByteStreamListener* doorbellListener{nullptr};
+
+    std::vector<uint8_t> data = std::vector<uint8_t>(16, 0xAB);
+    ConstBuffer dataBuffer{data.data(), data.size()};
+
+    //! Connecting side, the segment is attached right away, so writes complete without a peer
+    auto MakeStream() -> std::unique_ptr<SharedMemoryRawByteStream>
+    {
+        auto doorbellStream = std::make_unique<NiceMock<MockRawByteStream>>();
+        doorbell = doorbellStream.get();
+        ON_CALL(*doorbell, SetListener(_)).WillByDefault([this](IRawByteStreamListener& doorbellStreamListener) {
+            doorbellListener = &doorbellStreamListener;
+        });
+
+        auto stream = std::make_unique<SharedMemoryRawByteStream>(
+            ioContext, std::move(doorbellStream), SharedMemoryRawByteStream::CreateSegment(RingCapacity), logger);
+        stream->SetListener(listener);
+        return stream;
+    }
+};
+
+
+TEST_F(Test_SharedMemoryRawByteStream, write_completion_is_delivered)
+{
+    auto stream = MakeStream();
+
+    EXPECT_CALL(listener, OnAsyncWriteSomeDone(_, data.size())).Times(1);
+
+    stream->AsyncWriteSome(ConstBufferSequence{&dataBuffer, 1});
+    ioContext.Run();
+}
+
+
+TEST_F(Test_SharedMemoryRawByteStream, write_completion_is_dropped_after_the_stream_was_destroyed)
+{
+    auto stream = MakeStream();
+
+    EXPECT_CALL(listener, OnAsyncWriteSomeDone(_, _)).Times(0);
+
+    stream->AsyncWriteSome(ConstBufferSequence{&dataBuffer, 1});
+    stream.reset();
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_SharedMemoryRawByteStream, shutdown_is_dropped_after_the_stream_was_destroyed)
+{
+    auto stream = MakeStream();
+    ASSERT_NE(doorbellListener, nullptr);
+
+    EXPECT_CALL(listener, OnShutdown(_)).Times(0);
+
+    // the peer closed the doorbell stream, the shutdown is posted to the listener
+    doorbellListener->OnShutdown(*doorbell);
+    stream.reset();
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_SharedMemoryRawByteStream, listener_can_destroy_the_stream_from_a_completion)
+{
+    auto stream = MakeStream();
+    ASSERT_NE(doorbellListener, nullptr);
+
+    // the write completion destroys the stream, the shutdown posted after it must not be delivered
+    EXPECT_CALL(listener, OnAsyncWriteSomeDone(_, _)).WillOnce([&stream](auto&, auto) {
+        stream.reset();
+    });
+    EXPECT_CALL(listener, OnShutdown(_)).Times(0);
+
+    stream->AsyncWriteSome(ConstBufferSequence{&dataBuffer, 1});
+    doorbellListener->OnShutdown(*doorbell);
+
+    ioContext.Run();
+}
+
+
+} // namespace
@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "impl/SharedMemoryRing.hpp"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+using VSilKit::ConstBuffer;
+using VSilKit::ConstBufferSequence;
+using VSilKit::MutableBuffer;
+using VSilKit::MutableBufferSequence;
+using VSilKit::SharedMemoryRing;
+using VSilKit::SharedMemoryRingHeader;
+
+
+constexpr size_t Capacity{64};
+
+
+struct Test_SharedMemoryRing : ::testing::Test
+{
+    // stands in for the shared memory segment, the ring header requires cache line alignment
+    static constexpr size_t MemorySize{1024};
+    std::vector<uint8_t> storage = std::vector<uint8_t>(MemorySize + 64);
+    void* memory{AlignedMemory(storage)};
+
+    SharedMemoryRing writer{SharedMemoryRing::Initialize(memory, Capacity)};
+    SharedMemoryRing reader{SharedMemoryRing::Attach(memory, MemorySize)};
+
+    static auto AlignedMemory(std::vector<uint8_t>& bytes) -> void*
+    {
+        void* pointer = bytes.data();
+        size_t space = bytes.size();
+        return std::align(64, MemorySize, pointer, space);
+    }
+
+    auto Header() -> SharedMemoryRingHeader&
+    {
+        return *static_cast<SharedMemoryRingHeader*>(memory);
+    }
+
+    auto Write(const std::vector<uint8_t>& data) -> size_t
+    {
+        ConstBuffer buffer{data.data(), data.size()};
+        return writer.Write(ConstBufferSequence{&buffer, 1});
+    }
+
+    auto Read(size_t size) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        MutableBuffer buffer{data.data(), data.size()};
+        data.resize(reader.Read(MutableBufferSequence{&buffer, 1}));
+        return data;
+    }
+};
+
+
+auto Iota(size_t size, uint8_t start) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data(size);
+    std::iota(data.begin(), data.end(), start);
+    return data;
+}
+
+
+TEST_F(Test_SharedMemoryRing, attach_validates_the_capacity)
+{
+    EXPECT_TRUE(reader.IsValid());
+    EXPECT_EQ(reader.GetCapacity(), Capacity);
+
+    EXPECT_FALSE(SharedMemoryRing::Attach(memory, sizeof(SharedMemoryRingHeader) + Capacity - 1).IsValid());
+
+    Header().capacity = 0;
+    EXPECT_FALSE(SharedMemoryRing::Attach(memory, MemorySize).IsValid());
+}
+
+TEST_F(Test_SharedMemoryRing, data_wraps_around_the_end_of_the_ring)
+{
+    EXPECT_TRUE(reader.IsEmpty());
+
+    ASSERT_EQ(Write(Iota(48, 0)), 48u);
+    ASSERT_EQ(Read(48), Iota(48, 0));
+    EXPECT_TRUE(reader.IsEmpty());
+
+    // the second write starts at offset 48 and continues at the start of the data area
+    ASSERT_EQ(Write(Iota(40, 100)), 40u);
+    EXPECT_EQ(Read(40), Iota(40, 100));
+
+    // a read into multiple buffers across the wrap-around
+    ASSERT_EQ(Write(Iota(64, 7)), 64u);
+    std::vector<uint8_t> first(10), second(100);
+    MutableBuffer buffers[] = {{first.data(), first.size()}, {second.data(), second.size()}};
+    ASSERT_EQ(reader.Read(MutableBufferSequence{buffers, 2}), 64u);
+    first.insert(first.end(), second.begin(), second.begin() + 54);
+    EXPECT_EQ(first, Iota(64, 7));
+}
+
+TEST_F(Test_SharedMemoryRing, full_ring_wakes_up_the_waiting_writer)
+{
+    ASSERT_EQ(Write(Iota(100, 0)), Capacity);
+    EXPECT_TRUE(writer.IsFull());
+
+    // the writer finds the ring full and announces that it waits
+    EXPECT_EQ(Write(Iota(1, 0)), 0u);
+    writer.SetWriterWaiting(true);
+
+    // the reader makes progress, takes the flag and would ring the doorbell, exactly once
+    EXPECT_EQ(Read(16), Iota(16, 0));
+    EXPECT_TRUE(reader.TakeWriterWaiting());
+    EXPECT_FALSE(reader.TakeWriterWaiting());
+
+    EXPECT_EQ(Write(Iota(32, 0)), 16u);
+}
+
+TEST_F(Test_SharedMemoryRing, empty_ring_wakes_up_the_waiting_reader)
+{
+    EXPECT_TRUE(Read(16).empty());
+    reader.SetReaderWaiting(true);
+
+    ASSERT_EQ(Write(Iota(8, 0)), 8u);
+    EXPECT_TRUE(writer.TakeReaderWaiting());
+    EXPECT_FALSE(writer.TakeReaderWaiting());
+
+    EXPECT_EQ(Read(16), Iota(8, 0));
+}
+
+TEST_F(Test_SharedMemoryRing, corrupted_positions_are_clamped_to_the_capacity)
+{
+    // a peer which advances the write position beyond the capacity cannot make the reader copy more than it
+    Header().writePosition.store(1000000);
+    EXPECT_EQ(Read(1024).size(), Capacity);
+
+    // a peer which moves the read position ahead of the write position cannot make the writer overrun the ring
+    Header().writePosition.store(0);
+    Header().readPosition.store(1000000);
+    EXPECT_LE(Write(Iota(1024, 0)), Capacity);
+
+    // the capacity in the shared header is only read when attaching
+    Header().capacity = 1u << 30;
+    EXPECT_EQ(reader.GetCapacity(), Capacity);
+}
+
+TEST_F(Test_SharedMemoryRing, threads_transfer_data_through_a_small_ring)
+{
+    // the doorbell is emulated by a condition variable, each side sleeps until the other side rings it
+    std::mutex mutex;
+    std::condition_variable doorbell;
+
+    const auto data = Iota(100000, 0);
+
+    std::thread writerThread{[&] {
+        size_t written{0};
+        while (written != data.size())
+        {
+            ConstBuffer buffer{data.data() + written, data.size() - written};
+            auto count = writer.Write(ConstBufferSequence{&buffer, 1});
+            if (count == 0)
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                writer.SetWriterWaiting(true);
+                count = writer.Write(ConstBufferSequence{&buffer, 1});
+                if (count == 0)
+                {
+                    doorbell.wait(lock);
+                    continue;
+                }
+            }
+            written += count;
+            writer.SetWriterWaiting(false);
+            if (writer.TakeReaderWaiting())
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                doorbell.notify_all();
+            }
+        }
+    }};
+
+    std::vector<uint8_t> received(data.size());
+    size_t readCount{0};
+    while (readCount != received.size())
+    {
+        MutableBuffer buffer{received.data() + readCount, received.size() - readCount};
+        auto count = reader.Read(MutableBufferSequence{&buffer, 1});
+        if (count == 0)
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            reader.SetReaderWaiting(true);
+            count = reader.Read(MutableBufferSequence{&buffer, 1});
+            if (count == 0)
+            {
+                doorbell.wait(lock);
+                continue;
+            }
+        }
+        readCount += count;
+        reader.SetReaderWaiting(false);
+        if (reader.TakeWriterWaiting())
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            doorbell.notify_all();
+        }
+    }
+
+    writerThread.join();
+    EXPECT_EQ(received, data);
+}
+
+
+} // namespace
@@ -8,6 +8,9 @@
 #include "AsioConnector.hpp"
 #include "AsioTimer.hpp"
 #include "SetAsioSocketOptions.hpp"
+#include "SharedMemoryAcceptor.hpp"
+#include "SharedMemoryConnector.hpp"
+#include "SharedMemorySegment.hpp"
 
 #include "util/Exceptions.hpp"
 #include "util/TracingMacros.hpp"
@@ -33,6 +36,9 @@ namespace VSilKit {
 
 namespace {
 
+// capacity of each of the two rings (one per direction) of a shared memory stream
+constexpr size_t SHARED_MEMORY_RING_CAPACITY{256 * 1024};
+
 // only TCP/IP need platform tweaks
 template <typename AcceptorT>
 void SetPlatformOptions(AcceptorT&)
@@ -269,6 +275,33 @@ auto AsioIoContext::MakeLocalConnector(const std::string& path) -> std::unique_p
 }
 
 
+auto AsioIoContext::MakeSharedMemoryAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor>
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", path);
+
+    if (!SharedMemorySegment::IsSupported())
+    {
+        throw SilKit::SilKitError{"shared memory transport is not supported on this platform"};
+    }
+
+    return std::make_unique<SharedMemoryAcceptor>(*this, MakeLocalAcceptor(path), *_logger);
+}
+
+
+auto AsioIoContext::MakeSharedMemoryConnector(const std::string& path) -> std::unique_ptr<IConnector>
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", path);
+
+    if (!SharedMemorySegment::IsSupported())
+    {
+        throw SilKit::SilKitError{"shared memory transport is not supported on this platform"};
+    }
+
+    return std::make_unique<SharedMemoryConnector>(*this, MakeLocalConnector(path), SHARED_MEMORY_RING_CAPACITY,
+                                                   *_logger);
+}
+
+
 auto AsioIoContext::MakeTimer() -> std::unique_ptr<ITimer>
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
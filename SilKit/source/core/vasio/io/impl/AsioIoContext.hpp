@@ -42,6 +42,8 @@ public: // IIoContext
     auto MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> override;
     auto MakeTcpConnector(const std::string& address, uint16_t port) -> std::unique_ptr<IConnector> override;
     auto MakeLocalConnector(const std::string& path) -> std::unique_ptr<IConnector> override;
+    auto MakeSharedMemoryAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> override;
+    auto MakeSharedMemoryConnector(const std::string& path) -> std::unique_ptr<IConnector> override;
     auto MakeTimer() -> std::unique_ptr<ITimer> override;
     auto Resolve(const std::string& name) -> std::vector<std::string> override;
     void SetLogger(SilKit::Services::Logging::ILogger& logger) override;
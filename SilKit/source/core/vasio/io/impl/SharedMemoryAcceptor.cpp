@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryAcceptor.hpp"
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "util/TracingMacros.hpp"
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryAcceptor
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+SharedMemoryAcceptor::SharedMemoryAcceptor(IIoContext& ioContext, std::unique_ptr<IAcceptor> localDomainAcceptor,
+                                           SilKit::Services::Logging::ILogger& logger)
+    : _ioContext{&ioContext}
+    , _acceptor{std::move(localDomainAcceptor)}
+    , _logger{&logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _acceptor->SetListener(*this);
+}
+
+
+SharedMemoryAcceptor::~SharedMemoryAcceptor()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryAcceptor::SetListener(IAcceptorListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+auto SharedMemoryAcceptor::GetLocalEndpoint() const -> std::string
+{
+    const std::string localPrefix{"local://"};
+
+    auto endpoint{_acceptor->GetLocalEndpoint()};
+    if (endpoint.compare(0, localPrefix.size(), localPrefix) == 0)
+    {
+        endpoint.replace(0, localPrefix.size(), "shm://");
+    }
+
+    return endpoint;
+}
+
+
+void SharedMemoryAcceptor::AsyncAccept(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", timeout.count());
+
+    _acceptor->AsyncAccept(timeout);
+}
+
+
+void SharedMemoryAcceptor::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _acceptor->Shutdown();
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
+
+    auto sharedMemoryStream{std::make_unique<SharedMemoryRawByteStream>(*_ioContext, std::move(stream), *_logger)};
+    _listener->OnAsyncAcceptSuccess(*this, std::move(sharedMemoryStream));
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptFailure(IAcceptor&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _listener->OnAsyncAcceptFailure(*this);
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "IAcceptor.hpp"
+#include "IIoContext.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+
+
+namespace VSilKit {
+
+
+/// Accepts shared memory streams. The connections are accepted by a local-domain acceptor, which is wrapped by this
+/// class. Each accepted local-domain stream becomes the doorbell stream of a SharedMemoryRawByteStream.
+class SharedMemoryAcceptor final
+    : public IAcceptor
+    , private IAcceptorListener
+{
+    IAcceptorListener* _listener{nullptr};
+
+    IIoContext* _ioContext{nullptr};
+    std::unique_ptr<IAcceptor> _acceptor;
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    SharedMemoryAcceptor(IIoContext& ioContext, std::unique_ptr<IAcceptor> localDomainAcceptor,
+                         SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryAcceptor() override;
+
+public: // IAcceptor
+    void SetListener(IAcceptorListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    void AsyncAccept(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IAcceptorListener
+    void OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncAcceptFailure(IAcceptor& acceptor) override;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryConnector.hpp"
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "util/TracingMacros.hpp"
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryConnector
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+SharedMemoryConnector::SharedMemoryConnector(IIoContext& ioContext, std::unique_ptr<IConnector> localDomainConnector,
+                                             size_t ringCapacity, SilKit::Services::Logging::ILogger& logger)
+    : _ioContext{&ioContext}
+    , _connector{std::move(localDomainConnector)}
+    , _ringCapacity{ringCapacity}
+    , _logger{&logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _connector->SetListener(*this);
+}
+
+
+SharedMemoryConnector::~SharedMemoryConnector()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryConnector::SetListener(IConnectorListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+void SharedMemoryConnector::AsyncConnect(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}ms)", timeout.count());
+
+    _connector->AsyncConnect(timeout);
+}
+
+
+void SharedMemoryConnector::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _connector->Shutdown();
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
+
+    std::unique_ptr<IRawByteStream> sharedMemoryStream;
+
+    try
+    {
+        auto segment{SharedMemoryRawByteStream::CreateSegment(_ringCapacity)};
+        sharedMemoryStream =
+            std::make_unique<SharedMemoryRawByteStream>(*_ioContext, std::move(stream), std::move(segment), *_logger);
+    }
+    catch (const std::exception& exception)
+    {
+        Log::Warn(_logger, "SharedMemoryConnector: failed to set up shared memory stream: {}", exception.what());
+        _listener->OnAsyncConnectFailure(*this);
+        return;
+    }
+
+    _listener->OnAsyncConnectSuccess(*this, std::move(sharedMemoryStream));
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectFailure(IConnector&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "IConnector.hpp"
+#include "IIoContext.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+
+
+namespace VSilKit {
+
+
+/// Connects shared memory streams. The connection is established by a local-domain connector, which is wrapped by this
+/// class. On success, a new shared memory segment is created and announced to the peer through the local-domain
+/// stream.
+class SharedMemoryConnector final
+    : public IConnector
+    , private IConnectorListener
+{
+    IConnectorListener* _listener{nullptr};
+
+    IIoContext* _ioContext{nullptr};
+    std::unique_ptr<IConnector> _connector;
+    size_t _ringCapacity{0};
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    SharedMemoryConnector(IIoContext& ioContext, std::unique_ptr<IConnector> localDomainConnector, size_t ringCapacity,
+                          SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryConnector() override;
+
+public: // IConnector
+    void SetListener(IConnectorListener& listener) override;
+    void AsyncConnect(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IConnectorListener
+    void OnAsyncConnectSuccess(IConnector& connector, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncConnectFailure(IConnector& connector) override;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,484 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <cstring>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryRawByteStream
+#    define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#    define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+// shared memory segment names are short, anything larger is a protocol violation
+constexpr uint32_t MAX_SEGMENT_NAME_SIZE{255};
+
+auto MakeSharedMemoryEndpoint(const std::string& localDomainEndpoint) -> std::string
+{
+    const std::string localPrefix{"local://"};
+
+    if (localDomainEndpoint.compare(0, localPrefix.size(), localPrefix) == 0)
+    {
+        return "shm://" + localDomainEndpoint.substr(localPrefix.size());
+    }
+
+    return localDomainEndpoint;
+}
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+auto SharedMemoryRawByteStream::CreateSegment(size_t ringCapacity) -> std::unique_ptr<SharedMemorySegment>
+{
+    const auto ringSize{SharedMemoryRing::RequiredSize(ringCapacity)};
+
+    auto segment{SharedMemorySegment::Create(2 * ringSize)};
+
+    // the first ring transfers data from the connecting to the accepting side, the second ring in the other direction
+    auto* data{static_cast<uint8_t*>(segment->GetData())};
+    SharedMemoryRing::Initialize(data, ringCapacity);
+    SharedMemoryRing::Initialize(data + ringSize, ringCapacity);
+
+    return segment;
+}
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(IIoContext& ioContext, std::unique_ptr<IRawByteStream> doorbell,
+                                                     std::unique_ptr<SharedMemorySegment> segment,
+                                                     SilKit::Services::Logging::ILogger& logger)
+    : _self{std::make_shared<std::atomic<SharedMemoryRawByteStream*>>(this)}
+    , _ioContext{&ioContext}
+    , _doorbell{std::move(doorbell)}
+    , _localEndpoint{MakeSharedMemoryEndpoint(_doorbell->GetLocalEndpoint())}
+    , _remoteEndpoint{MakeSharedMemoryEndpoint(_doorbell->GetRemoteEndpoint())}
+    , _logger{&logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", segment->GetName());
+
+    _doorbell->SetListener(*this);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    // the first message on the doorbell stream is the size-prefixed name of the segment
+    const auto& name{segment->GetName()};
+    const auto nameSize{static_cast<uint32_t>(name.size())};
+
+    _doorbellWriteData.resize(sizeof(nameSize) + name.size());
+    std::memcpy(_doorbellWriteData.data(), &nameSize, sizeof(nameSize));
+    std::memcpy(_doorbellWriteData.data() + sizeof(nameSize), name.data(), name.size());
+
+    AttachSegment(std::move(segment), true);
+
+    _doorbellWriting = true;
+    _doorbellWriteBuffer = ConstBuffer{_doorbellWriteData.data(), _doorbellWriteData.size()};
+    _doorbell->AsyncWriteSome(ConstBufferSequence{&_doorbellWriteBuffer, 1});
+}
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(IIoContext& ioContext, std::unique_ptr<IRawByteStream> doorbell,
+                                                     SilKit::Services::Logging::ILogger& logger)
+    : _self{std::make_shared<std::atomic<SharedMemoryRawByteStream*>>(this)}
+    , _ioContext{&ioContext}
+    , _doorbell{std::move(doorbell)}
+    , _localEndpoint{MakeSharedMemoryEndpoint(_doorbell->GetLocalEndpoint())}
+    , _remoteEndpoint{MakeSharedMemoryEndpoint(_doorbell->GetRemoteEndpoint())}
+    , _logger{&logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _doorbell->SetListener(*this);
+}
+
+
+SharedMemoryRawByteStream::~SharedMemoryRawByteStream()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _self->store(nullptr);
+}
+
+
+void SharedMemoryRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+auto SharedMemoryRawByteStream::GetLocalEndpoint() const -> std::string
+{
+    return _localEndpoint;
+}
+
+
+auto SharedMemoryRawByteStream::GetRemoteEndpoint() const -> std::string
+{
+    return _remoteEndpoint;
+}
+
+
+void SharedMemoryRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownPending)
+    {
+        SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (_reading)
+    {
+        throw InvalidStateError{};
+    }
+
+    _reading = true;
+    _readBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryRead();
+}
+
+
+void SharedMemoryRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownPending)
+    {
+        SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (_writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    _writing = true;
+    _writeBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryWrite();
+}
+
+
+void SharedMemoryRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (!_shutdownPending)
+    {
+        _shutdownPending = true;
+        _doorbell->Shutdown();
+    }
+}
+
+
+// IRawByteStreamListener (doorbell)
+
+
+void SharedMemoryRawByteStream::OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", bytesTransferred);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _doorbellReading = false;
+
+    if (_shutdownPending)
+    {
+        return;
+    }
+
+    if (!_rx.IsValid() && !ConsumeAttachMessage(bytesTransferred))
+    {
+        WaitForDoorbell();
+        return;
+    }
+
+    // any other byte on the doorbell stream is a wake-up, check both rings for progress
+    if (_reading)
+    {
+        TryRead();
+    }
+
+    if (_writing)
+    {
+        TryWrite();
+    }
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", bytesTransferred);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _doorbellWriteBuffer.SliceOff(bytesTransferred);
+    if (_doorbellWriteBuffer.GetSize() != 0)
+    {
+        _doorbell->AsyncWriteSome(ConstBufferSequence{&_doorbellWriteBuffer, 1});
+        return;
+    }
+
+    _doorbellWriting = false;
+
+    if (_doorbellWritePending)
+    {
+        _doorbellWritePending = false;
+        RingDoorbell();
+    }
+}
+
+
+void SharedMemoryRawByteStream::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _shutdownPending = true;
+    }
+
+    // posted, so that all completions which were posted before are delivered before the shutdown
+    PostCompletion([](IRawByteStreamListener& listener, SharedMemoryRawByteStream& stream) {
+        listener.OnShutdown(stream);
+    });
+}
+
+
+// private
+
+
+void SharedMemoryRawByteStream::AttachSegment(std::unique_ptr<SharedMemorySegment> segment, bool isConnectingSide)
+{
+    auto* data{static_cast<uint8_t*>(segment->GetData())};
+
+    const auto segmentSize{segment->GetSize()};
+
+    auto toAcceptingSide{SharedMemoryRing::Attach(data, segmentSize / 2)};
+    if (!toAcceptingSide.IsValid())
+    {
+        throw SilKit::SilKitError{"SharedMemoryRawByteStream: invalid shared memory segment layout"};
+    }
+
+    const auto ringSize{SharedMemoryRing::RequiredSize(toAcceptingSide.GetCapacity())};
+
+    auto toConnectingSide{SharedMemoryRing::Attach(data + ringSize, segmentSize - ringSize)};
+    if (!toConnectingSide.IsValid() || toConnectingSide.GetCapacity() != toAcceptingSide.GetCapacity())
+    {
+        throw SilKit::SilKitError{"SharedMemoryRawByteStream: invalid shared memory segment layout"};
+    }
+
+    _tx = isConnectingSide ? toAcceptingSide : toConnectingSide;
+    _rx = isConnectingSide ? toConnectingSide : toAcceptingSide;
+    _segment = std::move(segment);
+}
+
+
+auto SharedMemoryRawByteStream::ConsumeAttachMessage(size_t bytesTransferred) -> bool
+{
+    _attachMessage.insert(_attachMessage.end(), _doorbellReadData.begin(),
+                          _doorbellReadData.begin() + static_cast<std::ptrdiff_t>(bytesTransferred));
+
+    uint32_t nameSize{0};
+    if (_attachMessage.size() < sizeof(nameSize))
+    {
+        return false;
+    }
+
+    std::memcpy(&nameSize, _attachMessage.data(), sizeof(nameSize));
+
+    try
+    {
+        if (nameSize == 0 || nameSize > MAX_SEGMENT_NAME_SIZE)
+        {
+            throw SilKit::SilKitError{"SharedMemoryRawByteStream: invalid shared memory segment name size"};
+        }
+
+        if (_attachMessage.size() < sizeof(nameSize) + nameSize)
+        {
+            return false;
+        }
+
+        const std::string name{_attachMessage.begin() + sizeof(nameSize),
+                               _attachMessage.begin() + sizeof(nameSize) + nameSize};
+
+        auto segment{SharedMemorySegment::Open(name)};
+        // both sides have mapped the segment, the name is no longer required
+        segment->Unlink();
+
+        AttachSegment(std::move(segment), false);
+    }
+    catch (const std::exception& exception)
+    {
+        Log::Warn(_logger, "SharedMemoryRawByteStream: failed to attach shared memory segment: {}", exception.what());
+
+        _shutdownPending = true;
+        _doorbell->Shutdown();
+        return false;
+    }
+
+    _attachMessage.clear();
+    _attachMessage.shrink_to_fit();
+    return true;
+}
+
+
+void SharedMemoryRawByteStream::TryRead()
+{
+    if (!_rx.IsValid())
+    {
+        WaitForDoorbell();
+        return;
+    }
+
+    const MutableBufferSequence bufferSequence{_readBufferSequence.data(), _readBufferSequence.size()};
+
+    auto bytesTransferred{_rx.Read(bufferSequence)};
+    if (bytesTransferred == 0)
+    {
+        // announce that we are waiting, and re-check to avoid missing a concurrent write
+        _rx.SetReaderWaiting(true);
+
+        bytesTransferred = _rx.Read(bufferSequence);
+        if (bytesTransferred == 0)
+        {
+            WaitForDoorbell();
+            return;
+        }
+    }
+
+    _rx.SetReaderWaiting(false);
+
+    if (_rx.TakeWriterWaiting())
+    {
+        RingDoorbell();
+    }
+
+    _reading = false;
+
+    PostCompletion([bytesTransferred](IRawByteStreamListener& listener, SharedMemoryRawByteStream& stream) {
+        listener.OnAsyncReadSomeDone(stream, bytesTransferred);
+    });
+}
+
+
+void SharedMemoryRawByteStream::TryWrite()
+{
+    if (!_tx.IsValid())
+    {
+        WaitForDoorbell();
+        return;
+    }
+
+    const ConstBufferSequence bufferSequence{_writeBufferSequence.data(), _writeBufferSequence.size()};
+
+    auto bytesTransferred{_tx.Write(bufferSequence)};
+    if (bytesTransferred == 0)
+    {
+        // announce that we are waiting, and re-check to avoid missing a concurrent read
+        _tx.SetWriterWaiting(true);
+
+        bytesTransferred = _tx.Write(bufferSequence);
+        if (bytesTransferred == 0)
+        {
+            WaitForDoorbell();
+            return;
+        }
+    }
+
+    _tx.SetWriterWaiting(false);
+
+    if (_tx.TakeReaderWaiting())
+    {
+        RingDoorbell();
+    }
+
+    _writing = false;
+
+    PostCompletion([bytesTransferred](IRawByteStreamListener& listener, SharedMemoryRawByteStream& stream) {
+        listener.OnAsyncWriteSomeDone(stream, bytesTransferred);
+    });
+}
+
+
+void SharedMemoryRawByteStream::PostCompletion(
+    std::function<void(IRawByteStreamListener& listener, SharedMemoryRawByteStream& stream)> completion)
+{
+    // The stream is owned by its listener, which may destroy it before the posted completion is executed
+    _ioContext->Post([self = _self, completion = std::move(completion)] {
+        auto* stream{self->load()};
+        if (stream == nullptr)
+        {
+            return;
+        }
+
+        completion(*stream->_listener, *stream);
+    });
+}
+
+
+void SharedMemoryRawByteStream::WaitForDoorbell()
+{
+    // The doorbell stream is only read while waiting, this also detects the shutdown of the peer.
+    if (_doorbellReading || _shutdownPending)
+    {
+        return;
+    }
+
+    _doorbellReading = true;
+    _doorbellReadBuffer = MutableBuffer{_doorbellReadData.data(), _doorbellReadData.size()};
+    _doorbell->AsyncReadSome(MutableBufferSequence{&_doorbellReadBuffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::RingDoorbell()
+{
+    if (_shutdownPending)
+    {
+        return;
+    }
+
+    if (_doorbellWriting)
+    {
+        _doorbellWritePending = true;
+        return;
+    }
+
+    _doorbellWriting = true;
+    _doorbellWriteData.assign(1, uint8_t{0});
+    _doorbellWriteBuffer = ConstBuffer{_doorbellWriteData.data(), _doorbellWriteData.size()};
+    _doorbell->AsyncWriteSome(ConstBufferSequence{&_doorbellWriteBuffer, 1});
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
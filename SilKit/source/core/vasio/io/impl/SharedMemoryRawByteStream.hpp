@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IIoContext.hpp"
+#include "IRawByteStream.hpp"
+
+#include "SharedMemoryRing.hpp"
+#include "SharedMemorySegment.hpp"
+
+#include "ILogger.hpp"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+/// Byte stream between two processes on the same host, which transfers the data through a pair of rings in a shared
+/// memory segment.
+///
+/// A connected local-domain stream (the 'doorbell') is used to transfer the name of the segment from the connecting to
+/// the accepting side, to wake up a peer waiting on an empty or full ring, and to detect the shutdown of the peer.
+class SharedMemoryRawByteStream final
+    : public IRawByteStream
+    , private IRawByteStreamListener
+{
+    IRawByteStreamListener* _listener{nullptr};
+
+    /// Shared with the completions posted to the IO context. Cleared by the destructor, so completions which are
+    /// executed after the stream was destroyed are dropped.
+    std::shared_ptr<std::atomic<SharedMemoryRawByteStream*>> _self;
+
+    IIoContext* _ioContext{nullptr};
+    std::unique_ptr<IRawByteStream> _doorbell;
+    std::unique_ptr<SharedMemorySegment> _segment;
+
+    SharedMemoryRing _rx;
+    SharedMemoryRing _tx;
+
+    std::mutex _mutex;
+    bool _shutdownPending{false};
+    bool _reading{false};
+    bool _writing{false};
+
+    std::vector<MutableBuffer> _readBufferSequence;
+    std::vector<ConstBuffer> _writeBufferSequence;
+
+    // doorbell stream state
+    bool _doorbellReading{false};
+    bool _doorbellWriting{false};
+    bool _doorbellWritePending{false};
+    std::array<uint8_t, 64> _doorbellReadData{};
+    MutableBuffer _doorbellReadBuffer;
+    std::vector<uint8_t> _doorbellWriteData;
+    ConstBuffer _doorbellWriteBuffer;
+    std::vector<uint8_t> _attachMessage;
+
+    std::string _localEndpoint;
+    std::string _remoteEndpoint;
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    /// Create a segment containing both rings, with the given capacity per direction.
+    static auto CreateSegment(size_t ringCapacity) -> std::unique_ptr<SharedMemorySegment>;
+
+    /// Connecting side: The segment was created via CreateSegment and its name is sent through the doorbell stream.
+    SharedMemoryRawByteStream(IIoContext& ioContext, std::unique_ptr<IRawByteStream> doorbell,
+                              std::unique_ptr<SharedMemorySegment> segment, SilKit::Services::Logging::ILogger& logger);
+
+    /// Accepting side: The segment is attached as soon as its name was received through the doorbell stream.
+    SharedMemoryRawByteStream(IIoContext& ioContext, std::unique_ptr<IRawByteStream> doorbell,
+                              SilKit::Services::Logging::ILogger& logger);
+
+    ~SharedMemoryRawByteStream() override;
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    auto GetRemoteEndpoint() const -> std::string override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+
+private: // IRawByteStreamListener (doorbell)
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private:
+    void AttachSegment(std::unique_ptr<SharedMemorySegment> segment, bool isConnectingSide);
+    auto ConsumeAttachMessage(size_t bytesTransferred) -> bool;
+
+    void TryRead();
+    void TryWrite();
+
+    void PostCompletion(
+        std::function<void(IRawByteStreamListener& listener, SharedMemoryRawByteStream& stream)> completion);
+
+    void WaitForDoorbell();
+    void RingDoorbell();
+    void StartDoorbellWrite();
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "util/Buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+
+namespace VSilKit {
+
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory rings require lock-free 64 bit atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory rings require lock-free 32 bit atomics");
+
+
+/// Header of a lock-free single-producer single-consumer byte ring, placed in memory which is shared between two
+/// processes. The data bytes immediately follow the ring header.
+///
+/// The waiting flags are used to avoid unnecessary wake-ups: A side which found the ring empty (reader) or full
+/// (writer) sets its flag and re-checks the ring before going to sleep. The other side clears the flag after it made
+/// progress and wakes the sleeping side if the flag was set. This requires sequentially consistent accesses to the
+/// positions of the other side and to the flags.
+struct SharedMemoryRingHeader
+{
+    alignas(64) std::atomic<uint64_t> writePosition;
+    alignas(64) std::atomic<uint64_t> readPosition;
+    alignas(64) std::atomic<uint32_t> readerWaiting;
+    std::atomic<uint32_t> writerWaiting;
+    uint64_t capacity;
+};
+
+
+/// Process-local view of a ring in shared memory.
+///
+/// The shared header can be modified by the peer at any time. The capacity is therefore only read once when attaching,
+/// and the number of available or free bytes derived from the shared positions is clamped to it, so a misbehaving peer
+/// can corrupt the transferred data, but never make the ring access memory outside of its data area.
+class SharedMemoryRing
+{
+public:
+    SharedMemoryRing() = default;
+
+    static auto RequiredSize(size_t capacity) -> size_t
+    {
+        // keep consecutive rings aligned to the cache line size
+        return (sizeof(SharedMemoryRingHeader) + capacity + 63u) & ~size_t{63u};
+    }
+
+    static auto Initialize(void* memory, size_t capacity) -> SharedMemoryRing
+    {
+        auto* header = new (memory) SharedMemoryRingHeader{};
+        header->writePosition.store(0);
+        header->readPosition.store(0);
+        header->readerWaiting.store(0);
+        header->writerWaiting.store(0);
+        header->capacity = capacity;
+        return SharedMemoryRing{header, capacity};
+    }
+
+    /// Attach to a ring initialized by the peer. Returns an invalid ring if the capacity stored in the header is zero
+    /// or the ring would not fit into maximumSize bytes.
+    static auto Attach(void* memory, size_t maximumSize) -> SharedMemoryRing
+    {
+        auto* header = static_cast<SharedMemoryRingHeader*>(memory);
+        const uint64_t capacity = header->capacity;
+        if (capacity == 0 || maximumSize < sizeof(SharedMemoryRingHeader)
+            || capacity > maximumSize - sizeof(SharedMemoryRingHeader))
+        {
+            return SharedMemoryRing{};
+        }
+        return SharedMemoryRing{header, static_cast<size_t>(capacity)};
+    }
+
+    auto IsValid() const -> bool
+    {
+        return _header != nullptr;
+    }
+
+    auto GetCapacity() const -> size_t
+    {
+        return _capacity;
+    }
+
+    auto IsEmpty() const -> bool
+    {
+        return Available() == 0;
+    }
+
+    auto IsFull() const -> bool
+    {
+        return Available() == _capacity;
+    }
+
+    void SetReaderWaiting(bool waiting)
+    {
+        _header->readerWaiting.store(waiting ? 1u : 0u);
+    }
+
+    void SetWriterWaiting(bool waiting)
+    {
+        _header->writerWaiting.store(waiting ? 1u : 0u);
+    }
+
+    /// Clear the flag of the reader and return if it was waiting.
+    auto TakeReaderWaiting() -> bool
+    {
+        return _header->readerWaiting.exchange(0) != 0;
+    }
+
+    /// Clear the flag of the writer and return if it was waiting.
+    auto TakeWriterWaiting() -> bool
+    {
+        return _header->writerWaiting.exchange(0) != 0;
+    }
+
+    /// Copy as many bytes from the buffer sequence into the ring as currently fit. Returns the number of bytes written.
+    auto Write(ConstBufferSequence bufferSequence) -> size_t
+    {
+        const auto position = _header->writePosition.load(std::memory_order_relaxed);
+        const auto free = _capacity - Clamp(position - _header->readPosition.load());
+
+        size_t transferred{0};
+        for (const auto& buffer : bufferSequence)
+        {
+            if (transferred == free)
+            {
+                break;
+            }
+
+            const auto count = std::min<size_t>(buffer.GetSize(), free - transferred);
+            CopyIn(position + transferred, static_cast<const uint8_t*>(buffer.GetData()), count);
+            transferred += count;
+        }
+
+        if (transferred != 0)
+        {
+            _header->writePosition.store(position + transferred);
+        }
+
+        return transferred;
+    }
+
+    /// Copy as many bytes from the ring into the buffer sequence as currently available. Returns the number of bytes
+    /// read.
+    auto Read(MutableBufferSequence bufferSequence) -> size_t
+    {
+        const auto position = _header->readPosition.load(std::memory_order_relaxed);
+        const auto available = Clamp(_header->writePosition.load() - position);
+
+        size_t transferred{0};
+        for (const auto& buffer : bufferSequence)
+        {
+            if (transferred == available)
+            {
+                break;
+            }
+
+            const auto count = std::min<size_t>(buffer.GetSize(), available - transferred);
+            CopyOut(position + transferred, static_cast<uint8_t*>(buffer.GetData()), count);
+            transferred += count;
+        }
+
+        if (transferred != 0)
+        {
+            _header->readPosition.store(position + transferred);
+        }
+
+        return transferred;
+    }
+
+private:
+    SharedMemoryRing(SharedMemoryRingHeader* header, size_t capacity)
+        : _header{header}
+        , _data{reinterpret_cast<uint8_t*>(header) + sizeof(SharedMemoryRingHeader)}
+        , _capacity{capacity}
+    {
+    }
+
+    auto Available() const -> size_t
+    {
+        return Clamp(_header->writePosition.load() - _header->readPosition.load());
+    }
+
+    auto Clamp(uint64_t count) const -> size_t
+    {
+        return static_cast<size_t>(std::min<uint64_t>(count, _capacity));
+    }
+
+    void CopyIn(uint64_t position, const uint8_t* source, size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const auto offset = static_cast<size_t>(position % _capacity);
+        const auto first = std::min<size_t>(count, _capacity - offset);
+        std::memcpy(_data + offset, source, first);
+        std::memcpy(_data, source + first, count - first);
+    }
+
+    void CopyOut(uint64_t position, uint8_t* target, size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const auto offset = static_cast<size_t>(position % _capacity);
+        const auto first = std::min<size_t>(count, _capacity - offset);
+        std::memcpy(target, _data + offset, first);
+        std::memcpy(target + first, _data, count - first);
+    }
+
+private:
+    SharedMemoryRingHeader* _header{nullptr};
+    uint8_t* _data{nullptr};
+    size_t _capacity{0};
+};
+
+
+} // namespace VSilKit
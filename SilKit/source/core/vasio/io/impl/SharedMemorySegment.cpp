@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemorySegment.hpp"
+
+#include "Uuid.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#if !defined(_WIN32)
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <cerrno>
+#    include <cstring>
+#endif
+
+
+namespace VSilKit {
+
+
+#if defined(_WIN32)
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return false;
+}
+
+auto SharedMemorySegment::Create(size_t) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SilKit::SilKitError{"SharedMemorySegment: shared memory transport is not supported on this platform"};
+}
+
+auto SharedMemorySegment::Open(const std::string&) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SilKit::SilKitError{"SharedMemorySegment: shared memory transport is not supported on this platform"};
+}
+
+SharedMemorySegment::~SharedMemorySegment() = default;
+
+void SharedMemorySegment::Unlink()
+{
+    _linked = false;
+}
+
+#else
+
+namespace {
+
+auto MakeError(const std::string& what) -> SilKit::SilKitError
+{
+    return SilKit::SilKitError{"SharedMemorySegment: " + what + ": " + std::strerror(errno)};
+}
+
+auto MapSegment(int fd, size_t size) -> void*
+{
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    return data == MAP_FAILED ? nullptr : data;
+}
+
+} // namespace
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return true;
+}
+
+auto SharedMemorySegment::Create(size_t size) -> std::unique_ptr<SharedMemorySegment>
+{
+    const auto name = "/silkit-" + to_string(SilKit::Util::Uuid::GenerateRandom());
+
+    const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd == -1)
+    {
+        throw MakeError("shm_open of '" + name + "' failed");
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(size)) == -1)
+    {
+        auto error = MakeError("ftruncate of '" + name + "' failed");
+        (void)close(fd);
+        (void)shm_unlink(name.c_str());
+        throw error;
+    }
+
+    void* data = MapSegment(fd, size);
+    (void)close(fd);
+
+    if (data == nullptr)
+    {
+        auto error = MakeError("mmap of '" + name + "' failed");
+        (void)shm_unlink(name.c_str());
+        throw error;
+    }
+
+    return std::unique_ptr<SharedMemorySegment>{new SharedMemorySegment{name, data, size}};
+}
+
+auto SharedMemorySegment::Open(const std::string& name) -> std::unique_ptr<SharedMemorySegment>
+{
+    const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd == -1)
+    {
+        throw MakeError("shm_open of '" + name + "' failed");
+    }
+
+    struct stat status{};
+    if (fstat(fd, &status) == -1 || status.st_size <= 0)
+    {
+        auto error = MakeError("fstat of '" + name + "' failed");
+        (void)close(fd);
+        throw error;
+    }
+
+    const auto size = static_cast<size_t>(status.st_size);
+
+    void* data = MapSegment(fd, size);
+    (void)close(fd);
+
+    if (data == nullptr)
+    {
+        throw MakeError("mmap of '" + name + "' failed");
+    }
+
+    return std::unique_ptr<SharedMemorySegment>{new SharedMemorySegment{name, data, size}};
+}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    Unlink();
+    (void)munmap(_data, _size);
+}
+
+void SharedMemorySegment::Unlink()
+{
+    if (_linked)
+    {
+        _linked = false;
+        (void)shm_unlink(_name.c_str());
+    }
+}
+
+#endif
+
+
+SharedMemorySegment::SharedMemorySegment(std::string name, void* data, size_t size)
+    : _name{std::move(name)}
+    , _data{data}
+    , _size{size}
+    , _linked{true}
+{
+}
+
+auto SharedMemorySegment::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+auto SharedMemorySegment::GetData() const -> void*
+{
+    return _data;
+}
+
+auto SharedMemorySegment::GetSize() const -> size_t
+{
+    return _size;
+}
+
+
+} // namespace VSilKit
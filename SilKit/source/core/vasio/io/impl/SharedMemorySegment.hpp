@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+namespace VSilKit {
+
+
+/// A named shared memory segment, mapped into the address space of the current process.
+class SharedMemorySegment
+{
+    std::string _name;
+    void* _data{nullptr};
+    size_t _size{0};
+    bool _linked{false};
+
+public:
+    /// Shared memory segments are currently only supported on POSIX platforms.
+    static auto IsSupported() -> bool;
+
+    /// Create and map a new, zero-initialized segment with a unique name.
+    static auto Create(size_t size) -> std::unique_ptr<SharedMemorySegment>;
+
+    /// Open and map an existing segment. The size is taken from the segment.
+    static auto Open(const std::string& name) -> std::unique_ptr<SharedMemorySegment>;
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    /// Unmaps the segment and removes its name, if Unlink was not called before.
+    ~SharedMemorySegment();
+
+public:
+    auto GetName() const -> const std::string&;
+    auto GetData() const -> void*;
+    auto GetSize() const -> size_t;
+
+    /// Remove the name of the segment. Existing mappings stay valid until they are unmapped.
+    void Unlink();
+
+private:
+    SharedMemorySegment(std::string name, void* data, size_t size);
+};
+
+
+} // namespace VSilKit
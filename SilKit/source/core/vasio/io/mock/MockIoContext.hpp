@@ -50,6 +50,10 @@ struct MockIoContext : IIoContext
 
     MOCK_METHOD(std::unique_ptr<IConnector>, MakeLocalConnector, (std::string const&), (override));
 
+    MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeSharedMemoryAcceptor, (std::string const&), (override));
+
+    MOCK_METHOD(std::unique_ptr<IConnector>, MakeSharedMemoryConnector, (std::string const&), (override));
+
     MOCK_METHOD(std::unique_ptr<ITimer>, MakeTimer, (), (override));
 
     MOCK_METHOD(std::vector<std::string>, Resolve, (std::string const&), (override));
@@ -103,6 +107,10 @@ struct MockIoContextWithExecutionQueue : IIoContext
 
     MOCK_METHOD(std::unique_ptr<IConnector>, MakeLocalConnector, (std::string const&), (override));
 
+    MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeSharedMemoryAcceptor, (std::string const&), (override));
+
+    MOCK_METHOD(std::unique_ptr<IConnector>, MakeSharedMemoryConnector, (std::string const&), (override));
+
     MOCK_METHOD(std::unique_ptr<ITimer>, MakeTimer, (), (override));
 
     MOCK_METHOD(std::vector<std::string>, Resolve, (std::string const&), (override));
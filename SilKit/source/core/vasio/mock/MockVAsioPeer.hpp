@@ -36,6 +36,7 @@ struct MockVAsioPeer : IVAsioPeer
     MOCK_METHOD(void, Shutdown, (), (override));
     MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
     MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
+    MOCK_METHOD(size_t, GetCompressionThreshold, (), (const, override));
 
     // IServiceEndpoint (via IVAsioPeer)
 
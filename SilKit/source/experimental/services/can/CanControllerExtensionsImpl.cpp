@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "silkit/services/can/ICanController.hpp"
+#include "silkit/participant/exception.hpp"
+
+#include "CanControllerExtensionsImpl.hpp"
+#include "ICanControllerExtensions.hpp"
+
+namespace {
+
+auto GetCanController(SilKit::Services::Can::ICanController* canController)
+    -> SilKit::Services::Can::ICanControllerExtensions*
+{
+    auto canControllerExtensions = dynamic_cast<SilKit::Services::Can::ICanControllerExtensions*>(canController);
+    if (canControllerExtensions == nullptr)
+    {
+        throw SilKit::SilKitError("canController is not a valid SilKit::Services::Can::ICanController*");
+    }
+    return canControllerExtensions;
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Can {
+
+void AddAcceptanceFilterImpl(SilKit::Services::Can::ICanController* canController, uint32_t canId, uint32_t mask,
+                             uint32_t flags, uint32_t flagsMask)
+{
+    GetCanController(canController)->AddAcceptanceFilter(canId, mask, flags, flagsMask);
+}
+
+} // namespace Can
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// ================================================================================
+//  ATTENTION: This header must NOT include any SIL Kit header (neither internal,
+//             nor public), as it is used to implement the 'legacy' ABI functions.
+// ================================================================================
+
+#include <cstdint>
+
+// Forward Declarations
+
+namespace SilKit {
+namespace Services {
+namespace Can {
+class ICanController;
+} // namespace Can
+} // namespace Services
+} // namespace SilKit
+
+
+// Function Declarations
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Can {
+
+void AddAcceptanceFilterImpl(SilKit::Services::Can::ICanController* canController, uint32_t canId, uint32_t mask,
+                             uint32_t flags, uint32_t flagsMask);
+
+} // namespace Can
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
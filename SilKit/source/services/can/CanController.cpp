@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/services/logging/ILogger.hpp"
 
 #include "IServiceDiscovery.hpp"
+#include "ServiceConfigKeys.hpp"
 #include "ServiceDatatypes.hpp"
 #include "CanController.hpp"
 #include "Tracing.hpp"
@@ -96,6 +97,18 @@ auto CanController::AllowReception(const IServiceEndpoint* from) const -> bool
     return _simulationBehavior.AllowReception(from);
 }
 
+auto CanController::AcceptsFrame(const WireCanFrameEvent& msg) const -> bool
+{
+    // The acceptance filters only apply to received frames, not to the controller's own transmissions
+    if (msg.direction != TransmitDirection::RX)
+    {
+        return true;
+    }
+
+    std::lock_guard<decltype(_acceptanceFiltersMutex)> lock{_acceptanceFiltersMutex};
+    return AcceptsCanId(_acceptanceFilters, msg.frame.canId, msg.frame.flags);
+}
+
 template <typename MsgT>
 void CanController::SendMsg(MsgT&& msg)
 {
@@ -167,13 +180,28 @@ void CanController::SendFrame(const CanFrame& frame, void* userContext)
     SendMsg(wireCanFrameEvent);
 }
 
+void CanController::AddAcceptanceFilter(uint32_t canId, uint32_t mask, CanFrameFlagMask flags,
+                                        CanFrameFlagMask flagsMask)
+{
+    // The controller's own descriptor is read concurrently and stays unchanged. A copy with the filters is announced
+    // again, which updates the descriptor known to the service discovery, so the other participants only send the
+    // frames the controller accepts. The lock keeps concurrent announcements in the order of the filters.
+    Core::ServiceDescriptor announcedDescriptor{_serviceDescriptor};
+
+    std::lock_guard<decltype(_acceptanceFiltersMutex)> lock{_acceptanceFiltersMutex};
+    _acceptanceFilters.push_back(CanAcceptanceFilter{canId, mask, flags, flagsMask});
+    announcedDescriptor.SetSupplementalDataItem(Core::Discovery::supplKeyCanControllerAcceptanceFilters,
+                                                FormatCanAcceptanceFilters(_acceptanceFilters));
+    _participant->GetServiceDiscovery()->NotifyServiceCreated(announcedDescriptor);
+}
+
 //------------------------
 // ReceiveMsg
 //------------------------
 
 void CanController::ReceiveMsg(const IServiceEndpoint* from, const WireCanFrameEvent& msg)
 {
-    if (!AllowReception(from))
+    if (!AllowReception(from) || !AcceptsFrame(msg))
     {
         return;
     }
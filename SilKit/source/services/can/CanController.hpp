@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "ITimeConsumer.hpp"
 #include "IMsgForCanController.hpp"
+#include "ICanControllerExtensions.hpp"
 #include "IParticipantInternal.hpp"
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
@@ -46,6 +47,7 @@ namespace Can {
 
 class CanController
     : public ICanController
+    , public ICanControllerExtensions
     , public IMsgForCanController
     , public ITraceMessageSource
     , public Core::IServiceEndpoint
@@ -100,6 +102,10 @@ public:
         CanTransmitStatusMask statusMask = SilKit_CanTransmitStatus_DefaultMask) override;
     void RemoveFrameTransmitHandler(HandlerId handlerId) override;
 
+    // ICanControllerExtensions
+    void AddAcceptanceFilter(uint32_t canId, uint32_t mask, CanFrameFlagMask flags,
+                             CanFrameFlagMask flagsMask) override;
+
     // IMsgForCanController
     void ReceiveMsg(const IServiceEndpoint* from, const Services::Can::WireCanFrameEvent& msg) override;
     void ReceiveMsg(const IServiceEndpoint* from, const Services::Can::CanControllerStatus& msg) override;
@@ -167,6 +173,7 @@ private:
 
     auto IsRelevantNetwork(const Core::ServiceDescriptor& remoteServiceDescriptor) const -> bool;
     auto AllowReception(const IServiceEndpoint* from) const -> bool;
+    auto AcceptsFrame(const WireCanFrameEvent& msg) const -> bool;
 
     template <typename MsgT>
     inline void SendMsg(MsgT&& msg);
@@ -191,6 +198,9 @@ private:
     CanErrorState _errorState = CanErrorState::NotAvailable;
     CanConfigureBaudrate _baudRate = { 0, 0, 0 };
 
+    mutable std::mutex _acceptanceFiltersMutex;
+    std::vector<CanAcceptanceFilter> _acceptanceFilters;
+
     template <typename MsgT>
     using FilteredCallbacks = Util::SynchronizedHandlers<FilteredCallback<MsgT>>;
 
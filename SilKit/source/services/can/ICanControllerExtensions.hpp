@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+
+#include "silkit/services/can/CanDatatypes.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Can {
+
+class ICanControllerExtensions
+{
+public:
+    virtual ~ICanControllerExtensions() = default;
+
+    virtual void AddAcceptanceFilter(uint32_t canId, uint32_t mask, CanFrameFlagMask flags,
+                                     CanFrameFlagMask flagsMask) = 0;
+};
+
+} // namespace Can
+} // namespace Services
+} // namespace SilKit
@@ -34,6 +34,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "CanController.hpp"
 #include "CanDatatypesUtils.hpp"
+#include "ServiceConfigKeys.hpp"
 
 namespace {
 
@@ -45,6 +46,7 @@ using testing::An;
 using testing::_;
 using testing::InSequence;
 using testing::NiceMock;
+using testing::SaveArg;
 
 using namespace SilKit::Core;
 using namespace SilKit::Services::Can;
@@ -211,6 +213,93 @@ TEST(Test_CanControllerTrivialSim, receive_can_message_rx_filter2)
     canController.ReceiveMsg(&canControllerPlaceholder, testFrameEvent);
 }
 
+TEST(Test_CanControllerTrivialSim, receive_can_message_acceptance_filter)
+{
+    using namespace std::placeholders;
+
+    ServiceDescriptor senderDescriptor{};
+    senderDescriptor.SetParticipantNameAndComputeId("canControllerPlaceholder");
+    senderDescriptor.SetServiceId(17);
+
+    MockParticipant mockParticipant;
+    CanControllerCallbacks callbackProvider;
+
+    SilKit::Config::CanController cfg;
+    CanController canController(&mockParticipant, cfg, mockParticipant.GetTimeProvider());
+    canController.AddFrameHandler(std::bind(&CanControllerCallbacks::FrameHandler, &callbackProvider, _1, _2));
+
+    // the filters are announced as an update of the controller, which is not removed
+    ServiceDescriptor announcedDescriptor;
+    EXPECT_CALL(mockParticipant.mockServiceDiscovery, NotifyServiceRemoved(_)).Times(0);
+    EXPECT_CALL(mockParticipant.mockServiceDiscovery, NotifyServiceCreated(_))
+        .WillOnce(SaveArg<0>(&announcedDescriptor));
+    canController.AddAcceptanceFilter(0x100, 0x700, 0, 0);
+
+    std::string announcedFilters;
+    ASSERT_TRUE(announcedDescriptor.GetSupplementalDataItem(
+        SilKit::Core::Discovery::supplKeyCanControllerAcceptanceFilters, announcedFilters));
+    EXPECT_EQ(ParseCanAcceptanceFilters(announcedFilters).size(), 1u);
+    EXPECT_EQ(announcedDescriptor.GetServiceId(), canController.GetServiceDescriptor().GetServiceId());
+
+    canController.Start();
+
+    CanController canControllerPlaceholder(&mockParticipant, cfg, mockParticipant.GetTimeProvider());
+    canControllerPlaceholder.SetServiceDescriptor(senderDescriptor);
+
+    WireCanFrameEvent acceptedFrameEvent{};
+    acceptedFrameEvent.frame.canId = 0x123;
+    acceptedFrameEvent.direction = SilKit::Services::TransmitDirection::RX;
+
+    WireCanFrameEvent rejectedFrameEvent{};
+    rejectedFrameEvent.frame.canId = 0x223;
+    rejectedFrameEvent.direction = SilKit::Services::TransmitDirection::RX;
+
+    EXPECT_CALL(callbackProvider, FrameHandler(&canController, ToCanFrameEvent(acceptedFrameEvent))).Times(1);
+    EXPECT_CALL(callbackProvider, FrameHandler(&canController, ToCanFrameEvent(rejectedFrameEvent))).Times(0);
+
+    canController.ReceiveMsg(&canControllerPlaceholder, acceptedFrameEvent);
+    canController.ReceiveMsg(&canControllerPlaceholder, rejectedFrameEvent);
+}
+
+TEST(Test_CanControllerTrivialSim, receive_can_message_acceptance_filter_extended_id)
+{
+    using namespace std::placeholders;
+
+    ServiceDescriptor senderDescriptor{};
+    senderDescriptor.SetParticipantNameAndComputeId("canControllerPlaceholder");
+    senderDescriptor.SetServiceId(17);
+
+    MockParticipant mockParticipant;
+    CanControllerCallbacks callbackProvider;
+
+    SilKit::Config::CanController cfg;
+    CanController canController(&mockParticipant, cfg, mockParticipant.GetTimeProvider());
+    canController.AddFrameHandler(std::bind(&CanControllerCallbacks::FrameHandler, &callbackProvider, _1, _2));
+
+    // only extended frames with the identifier 0x123 pass the filter
+    const auto ide = static_cast<CanFrameFlagMask>(CanFrameFlag::Ide);
+    canController.AddAcceptanceFilter(0x123, 0x1FFFFFFF, ide, ide);
+    canController.Start();
+
+    CanController canControllerPlaceholder(&mockParticipant, cfg, mockParticipant.GetTimeProvider());
+    canControllerPlaceholder.SetServiceDescriptor(senderDescriptor);
+
+    WireCanFrameEvent extendedFrameEvent{};
+    extendedFrameEvent.frame.canId = 0x123;
+    extendedFrameEvent.frame.flags = ide;
+    extendedFrameEvent.direction = SilKit::Services::TransmitDirection::RX;
+
+    WireCanFrameEvent standardFrameEvent{};
+    standardFrameEvent.frame.canId = 0x123;
+    standardFrameEvent.direction = SilKit::Services::TransmitDirection::RX;
+
+    EXPECT_CALL(callbackProvider, FrameHandler(&canController, ToCanFrameEvent(extendedFrameEvent))).Times(1);
+    EXPECT_CALL(callbackProvider, FrameHandler(&canController, ToCanFrameEvent(standardFrameEvent))).Times(0);
+
+    canController.ReceiveMsg(&canControllerPlaceholder, extendedFrameEvent);
+    canController.ReceiveMsg(&canControllerPlaceholder, standardFrameEvent);
+}
+
 TEST(Test_CanControllerTrivialSim, receive_can_message_tx_filter1)
 {
     using namespace std::placeholders;
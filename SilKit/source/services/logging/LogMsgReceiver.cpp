@@ -37,6 +37,14 @@ void LogMsgReceiver::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Lo
     _logger->LogReceivedMsg(msg);
 }
 
+void LogMsgReceiver::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const LogMsgBatch& msg)
+{
+    for (const auto& logMsg : msg.messages)
+    {
+        _logger->LogReceivedMsg(logMsg);
+    }
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
@@ -21,23 +21,152 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LogMsgSender.hpp"
 
+#include <algorithm>
+
+#include "ILogger.hpp"
+#include "traits/SilKitMsgTraits.hpp"
+
 namespace SilKit {
 namespace Services {
 namespace Logging {
 
+constexpr size_t LogMsgSender::MaxBatchSize;
+constexpr size_t LogMsgSender::MaxBatchPayloadBytes;
+constexpr std::chrono::milliseconds LogMsgSender::FlushInterval;
+
+namespace {
+
+auto IsUrgent(const LogMsg& msg) -> bool
+{
+    return msg.level >= Level::Error;
+}
+
+auto PayloadSize(const LogMsg& msg) -> size_t
+{
+    return msg.logger_name.size() + msg.source.filename.size() + msg.source.funcname.size() + msg.payload.size();
+}
+
+} // namespace
+
 LogMsgSender::LogMsgSender(Core::IParticipantInternal* participant)
     : _participant{participant}
 {
+    // The timer thread is shared by all participants, the batch is sent from the IO context of the participant
+    _flushTimer.WithPeriod(
+        FlushInterval,
+        [this](auto) {
+            if (HasPendingMessages())
+            {
+                _participant->ExecuteDeferred([this] { Flush(); });
+            }
+        },
+        [logger = _participant->GetLogger()](const std::string& message) { Error(logger, "LogMsgSender: {}", message); });
+}
+
+LogMsgSender::~LogMsgSender()
+{
+    _flushTimer.Stop();
 }
 
 void LogMsgSender::SendLogMsg(const LogMsg& msg)
 {
-    _participant->SendMsg(this, msg);
+    SendLogMsg(LogMsg{msg});
 }
 
 void LogMsgSender::SendLogMsg(LogMsg&& msg)
 {
-    _participant->SendMsg(this, std::move(msg));
+    // Held until the batch is sent, so batches cannot overtake each other
+    std::unique_lock<decltype(_sendMutex)> sendLock{_sendMutex};
+
+    LogMsgBatch batch;
+    {
+        std::unique_lock<decltype(_batchMutex)> lock{_batchMutex};
+        if (!_batchingEnabled)
+        {
+            lock.unlock();
+            _participant->SendMsg(this, std::move(msg));
+            return;
+        }
+
+        const auto urgent = IsUrgent(msg);
+        _batchPayloadBytes += PayloadSize(msg);
+        _batch.messages.emplace_back(std::move(msg));
+
+        if (!urgent && _batch.messages.size() < MaxBatchSize && _batchPayloadBytes < MaxBatchPayloadBytes)
+        {
+            return;
+        }
+
+        std::swap(batch, _batch);
+        _batchPayloadBytes = 0;
+    }
+
+    // Send outside of the batch lock, log messages might be created while sending
+    SendBatch(batch);
+}
+
+void LogMsgSender::Flush()
+{
+    std::unique_lock<decltype(_sendMutex)> sendLock{_sendMutex};
+
+    LogMsgBatch batch;
+    {
+        std::unique_lock<decltype(_batchMutex)> lock{_batchMutex};
+        std::swap(batch, _batch);
+        _batchPayloadBytes = 0;
+    }
+
+    SendBatch(batch);
+}
+
+void LogMsgSender::DisableBatching()
+{
+    _flushTimer.Stop();
+
+    // Individual messages must not overtake the last batch
+    std::unique_lock<decltype(_sendMutex)> sendLock{_sendMutex};
+    {
+        std::unique_lock<decltype(_batchMutex)> lock{_batchMutex};
+        _batchingEnabled = false;
+    }
+    Flush();
+}
+
+auto LogMsgSender::HasPendingMessages() -> bool
+{
+    std::unique_lock<decltype(_batchMutex)> lock{_batchMutex};
+    return !_batch.messages.empty();
+}
+
+void LogMsgSender::SendBatch(const LogMsgBatch& batch)
+{
+    if (batch.messages.empty())
+    {
+        return;
+    }
+
+    const auto batchReceivers = _participant->GetParticipantNamesOfRemoteReceivers(
+        this, Core::SilKitMsgTraits<LogMsgBatch>::SerdesName());
+    if (!batchReceivers.empty())
+    {
+        _participant->SendMsg(this, batch);
+    }
+
+    // Participants of older versions only understand individual log messages
+    const auto receivers =
+        _participant->GetParticipantNamesOfRemoteReceivers(this, Core::SilKitMsgTraits<LogMsg>::SerdesName());
+    for (const auto& receiver : receivers)
+    {
+        if (std::find(batchReceivers.begin(), batchReceivers.end(), receiver) != batchReceivers.end())
+        {
+            continue;
+        }
+
+        for (const auto& msg : batch.messages)
+        {
+            _participant->SendMsg(this, receiver, msg);
+        }
+    }
 }
 
 } // namespace Logging
@@ -21,9 +21,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+
 #include "IMsgForLogMsgSender.hpp"
 #include "IParticipantInternal.hpp"
 #include "IServiceEndpoint.hpp"
+#include "Timer.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -37,11 +41,25 @@ public:
     // ----------------------------------------
     // Constructors and Destructor
     LogMsgSender(Core::IParticipantInternal* participant);
+    ~LogMsgSender();
+
+public:
+    //! Log messages are collected into a LogMsgBatch, which is sent when it is full, when a message of
+    //! level Error or higher is added, or after FlushInterval at the latest.
+    static constexpr size_t MaxBatchSize = 64;
+    static constexpr size_t MaxBatchPayloadBytes = 16 * 1024;
+    static constexpr std::chrono::milliseconds FlushInterval{50};
 
 public:
     void SendLogMsg(const LogMsg& msg);
     void SendLogMsg(LogMsg&& msg);
 
+    //! Send all pending log messages immediately.
+    void Flush();
+    //! Flush the pending log messages and send all further log messages individually.
+    //! Must be called before the connection of the participant is torn down.
+    void DisableBatching();
+
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
     inline auto GetServiceDescriptor() const -> const Core::ServiceDescriptor & override;
@@ -49,12 +67,22 @@ public:
 private:
     // ----------------------------------------
     // private methods
+    auto HasPendingMessages() -> bool;
+    void SendBatch(const LogMsgBatch& batch);
 
 private:
     // ----------------------------------------
     // private members
     Core::IParticipantInternal* _participant{nullptr};
     Core::ServiceDescriptor _serviceDescriptor{};
+
+    //! Serializes sending, recursive because log messages might be created while sending
+    std::recursive_mutex _sendMutex;
+    std::mutex _batchMutex;
+    LogMsgBatch _batch;
+    size_t _batchPayloadBytes{0};
+    bool _batchingEnabled{true};
+    Util::Timer _flushTimer;
 };
 
 // ================================================================================
@@ -28,6 +28,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "fmt/chrono.h"
 #include "fmt/format.h"
 #include "spdlog/spdlog.h"
+#include "spdlog/async_logger.h"
+#include "spdlog/details/thread_pool.h"
 #include "spdlog/sinks/null_sink.h"
 // NB: we do not use the windows color sink, as that will open "CONOUT$" and
 //     we won't be able to trivially capture its output in SilKitLauncher.
@@ -36,6 +38,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "spdlog/sinks/basic_file_sink.h"
 
 #include "SpdlogTypeConversion.hpp"
+#include "SetThreadName.hpp"
 
 
 namespace SilKit {
@@ -75,6 +78,47 @@ private:
     Logger::LogMsgHandler _logMsgHandler;
     bool _is_disabled{false};
 };
+
+// Copies the messages into the queue of the thread pool, which writes them to the sinks of the backend logger
+class SilKitAsyncSink : public spdlog::sinks::sink
+{
+public:
+    SilKitAsyncSink(std::shared_ptr<spdlog::async_logger> backend,
+                    std::shared_ptr<spdlog::details::thread_pool> threadPool)
+        : _backend{std::move(backend)}
+        , _threadPool{std::move(threadPool)}
+    {
+    }
+
+    void log(const spdlog::details::log_msg& msg) override
+    {
+        _threadPool->post_log(std::shared_ptr<spdlog::async_logger>{_backend}, msg,
+                              spdlog::async_overflow_policy::block);
+    }
+
+    void flush() override
+    {
+        _threadPool->post_flush(std::shared_ptr<spdlog::async_logger>{_backend},
+                                spdlog::async_overflow_policy::block);
+    }
+
+    void set_pattern(const std::string& pattern) override
+    {
+        _backend->set_pattern(pattern);
+    }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override
+    {
+        _backend->set_formatter(std::move(sink_formatter));
+    }
+
+private:
+    std::shared_ptr<spdlog::async_logger> _backend;
+    std::shared_ptr<spdlog::details::thread_pool> _threadPool;
+};
+
+// Number of messages which can be queued for the asynchronous sinks, callers block while the queue is full
+constexpr size_t asyncQueueSize{8192};
 } // anonymous namespace
 
 
@@ -136,9 +180,35 @@ Logger::Logger(const std::string& participantName, Config::Logging config)
         }
     }
 
+    if (_config.asynchronous && !_logger->sinks().empty())
+    {
+        // The remote sink is added later and keeps sending on the calling thread, as the sending service may be
+        // destroyed before the logger. All other sinks are moved behind a single sink feeding the queue.
+        _threadPool = std::make_shared<spdlog::details::thread_pool>(asyncQueueSize, 1, [] {
+            SilKit::Util::SetThreadName("SilKitLogger");
+        });
+
+        auto&& sinks = _logger->sinks();
+        auto backend = std::make_shared<spdlog::async_logger>(participantName, sinks.begin(), sinks.end(), _threadPool);
+        backend->set_level(spdlog::level::trace);
+
+        auto asyncSink = std::make_shared<SilKitAsyncSink>(std::move(backend), _threadPool);
+        asyncSink->set_level(_logger->level());
+        sinks.clear();
+        sinks.emplace_back(std::move(asyncSink));
+    }
+
     _logger->flush_on(to_spdlog(_config.flushLevel));
 }
 
+Logger::~Logger()
+{
+    // destroy the sinks before the thread pool, which then writes all queued messages before joining its thread
+    _remoteSink.reset();
+    _logger.reset();
+    _threadPool.reset();
+}
+
 void Logger::Log(Level level, const std::string& msg)
 {
     _logger->log(to_spdlog(level), msg);
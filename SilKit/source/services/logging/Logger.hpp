@@ -34,6 +34,9 @@ class logger;
 namespace sinks {
 class sink;
 } // namespace sinks
+namespace details {
+class thread_pool;
+} // namespace details
 } // namespace spdlog
 
 namespace SilKit {
@@ -51,6 +54,7 @@ public:
     // ----------------------------------------
     // Constructors and Destructor
     Logger(const std::string& participantName, Config::Logging config);
+    ~Logger();
 
     // ----------------------------------------
     // Public interface methods
@@ -81,6 +85,9 @@ private:
     // Private members
     Config::Logging _config;
 
+    // Asynchronous mode: formats and writes the messages of the stdout and file sinks on a dedicated thread.
+    // Must outlive _logger, the thread pool drains its queue when it is destroyed.
+    std::shared_ptr<spdlog::details::thread_pool> _threadPool;
     std::shared_ptr<spdlog::logger> _logger;
     std::shared_ptr<spdlog::sinks::sink> _remoteSink;
 };
@@ -21,6 +21,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LoggingSerdes.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include "silkit/participant/exception.hpp"
+
 
 namespace SilKit {
 namespace Services {
@@ -73,6 +78,84 @@ void Deserialize(MessageBuffer& buffer, LogMsg& out)
 {
     buffer >> out;
 }
+
+// A batch is encoded as a table of the distinct logger, file and function names, followed by the entries which
+// refer to these names by their index in the table.
+void Serialize(MessageBuffer& buffer, const LogMsgBatch& msg)
+{
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> stringIndices;
+    auto intern = [&strings, &stringIndices](const std::string& value) -> uint32_t {
+        const auto result = stringIndices.emplace(value, static_cast<uint32_t>(strings.size()));
+        if (result.second)
+        {
+            strings.push_back(value);
+        }
+        return result.first->second;
+    };
+
+    std::vector<uint32_t> indices;
+    indices.reserve(msg.messages.size() * 3);
+    for (const auto& entry : msg.messages)
+    {
+        indices.push_back(intern(entry.logger_name));
+        indices.push_back(intern(entry.source.filename));
+        indices.push_back(intern(entry.source.funcname));
+    }
+
+    buffer << strings << static_cast<uint32_t>(msg.messages.size());
+
+    auto index = indices.begin();
+    for (const auto& entry : msg.messages)
+    {
+        buffer << *index++
+               << entry.level
+               << entry.time
+               << *index++
+               << entry.source.line
+               << *index++
+               << entry.payload;
+    }
+}
+
+void Deserialize(MessageBuffer& buffer, LogMsgBatch& out)
+{
+    std::vector<std::string> strings;
+    uint32_t numMessages{0};
+    buffer >> strings >> numMessages;
+
+    auto lookup = [&strings](uint32_t index) -> const std::string& {
+        if (index >= strings.size())
+        {
+            throw SilKit::ProtocolError{"LogMsgBatch refers to an unknown string"};
+        }
+        return strings[index];
+    };
+
+    out.messages.clear();
+    // every message occupies several bytes in the buffer, so the remaining size bounds an untrusted count
+    out.messages.reserve(std::min<size_t>(numMessages, buffer.RemainingBytesLeft()));
+    for (uint32_t i = 0; i < numMessages; ++i)
+    {
+        uint32_t loggerNameIndex{0};
+        uint32_t filenameIndex{0};
+        uint32_t funcnameIndex{0};
+
+        LogMsg entry;
+        buffer >> loggerNameIndex
+               >> entry.level
+               >> entry.time
+               >> filenameIndex
+               >> entry.source.line
+               >> funcnameIndex
+               >> entry.payload;
+
+        entry.logger_name = lookup(loggerNameIndex);
+        entry.source.filename = lookup(filenameIndex);
+        entry.source.funcname = lookup(funcnameIndex);
+        out.messages.emplace_back(std::move(entry));
+    }
+}
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
@@ -44,6 +44,8 @@ void TraceTx(Logging::ILogger* logger, const Core::IServiceEndpoint* addr, const
 // Don't trace LogMessages - this could cause cycles!
 inline void TraceRx(Logging::ILogger* /*logger*/, Core::IServiceEndpoint* /*addr*/, const Logging::LogMsg& /*msg*/) {}
 inline void TraceTx(Logging::ILogger* /*logger*/, Core::IServiceEndpoint* /*addr*/, const Logging::LogMsg& /*msg*/) {}
+inline void TraceRx(Logging::ILogger* /*logger*/, Core::IServiceEndpoint* /*addr*/, const Logging::LogMsgBatch& /*msg*/) {}
+inline void TraceTx(Logging::ILogger* /*logger*/, Core::IServiceEndpoint* /*addr*/, const Logging::LogMsgBatch& /*msg*/) {}
 
 } // namespace Services
 } // namespace SilKit
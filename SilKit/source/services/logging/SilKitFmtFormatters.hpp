@@ -91,6 +91,7 @@ MAKE_FORMATTER(SilKit::Services::Lin::LinWakeupPulse);
 MAKE_FORMATTER(SilKit::Services::Lin::WireLinControllerConfig);
 
 MAKE_FORMATTER(SilKit::Services::Logging::LogMsg);
+MAKE_FORMATTER(SilKit::Services::Logging::LogMsgBatch);
 
 MAKE_FORMATTER(SilKit::Services::Orchestration::NextSimTask);
 MAKE_FORMATTER(SilKit::Services::Orchestration::ParticipantState);
@@ -21,7 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -52,10 +55,20 @@ using SilKit::Core::Tests::DummyParticipant;
 class MockParticipant : public DummyParticipant
 {
 public:
+    MockParticipant()
+    {
+        ON_CALL(*this, GetParticipantNamesOfRemoteReceivers(_, "LOGMSGBATCH"))
+            .WillByDefault(Return(std::vector<std::string>{"P2"}));
+    }
+
     MOCK_METHOD((void), SendMsg, (const IServiceEndpoint*, LogMsg&&));
+    MOCK_METHOD((void), SendMsg, (const IServiceEndpoint*, const LogMsgBatch&));
+    MOCK_METHOD((void), SendMsg, (const IServiceEndpoint*, const std::string&, const LogMsg&));
+    MOCK_METHOD((std::vector<std::string>), GetParticipantNamesOfRemoteReceivers,
+                (const IServiceEndpoint*, const std::string&), (override));
 };
 
-auto ALogMsgWith(std::string logger_name, Level level, std::string payload) -> Matcher<LogMsg&&>
+auto LogMsgWith(std::string logger_name, Level level, std::string payload)
 {
     return AllOf(
         Field(&LogMsg::logger_name, logger_name),
@@ -64,6 +77,16 @@ auto ALogMsgWith(std::string logger_name, Level level, std::string payload) -> M
     );
 }
 
+auto ALogMsgWith(std::string logger_name, Level level, std::string payload) -> Matcher<LogMsg&&>
+{
+    return LogMsgWith(logger_name, level, payload);
+}
+
+auto ALogMsgBatchWith(std::string logger_name, Level level, std::string payload) -> Matcher<const LogMsgBatch&>
+{
+    return Field(&LogMsgBatch::messages, ElementsAre(LogMsgWith(logger_name, level, payload)));
+}
+
 TEST(Test_Logger, log_level_conversion)
 {
     Level in{Level::Critical};
@@ -90,10 +113,117 @@ TEST(Test_Logger, send_log_message_with_sender)
     msg.level = Level::Info;
     msg.payload = std::string{"some payload"};
 
-    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, std::move(msg)))
+    // Messages below Error are sent with the next flush of the batch
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, ALogMsgBatchWith("Logger", Level::Info, "some payload")))
         .Times(1);
 
     logMsgSender.SendLogMsg(std::move(msg));
+    logMsgSender.Flush();
+}
+
+TEST(Test_Logger, send_log_message_to_participants_without_batch_support)
+{
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+
+    MockParticipant mockParticipant;
+    ON_CALL(mockParticipant, GetParticipantNamesOfRemoteReceivers(_, "LOGMSG"))
+        .WillByDefault(Return(std::vector<std::string>{"P2", "P3"}));
+
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    LogMsg msg;
+    msg.logger_name = "Logger";
+    msg.level = Level::Error;
+    msg.payload = std::string{"some payload"};
+
+    // P2 receives the batch, P3 only knows individual log messages
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, ALogMsgBatchWith("Logger", Level::Error, "some payload")))
+        .Times(1);
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, "P3", msg)).Times(1);
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, "P2", _)).Times(0);
+
+    logMsgSender.SendLogMsg(msg);
+}
+
+TEST(Test_Logger, send_log_message_without_batching)
+{
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+
+    MockParticipant mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    LogMsg msg;
+    msg.logger_name = "Logger";
+    msg.level = Level::Debug;
+    msg.payload = std::string{"pending"};
+
+    // Disabling the batching sends the pending messages
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, ALogMsgBatchWith("Logger", Level::Debug, "pending")))
+        .Times(1);
+    logMsgSender.SendLogMsg(msg);
+    logMsgSender.DisableBatching();
+    Mock::VerifyAndClearExpectations(&mockParticipant);
+
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, ALogMsgWith("Logger", Level::Debug, "direct"))).Times(1);
+    msg.payload = "direct";
+    logMsgSender.SendLogMsg(msg);
+}
+
+TEST(Test_Logger, periodic_flush_is_executed_deferred)
+{
+    // Records the deferred callbacks instead of executing them on an IO context
+    class DeferringParticipant : public MockParticipant
+    {
+    public:
+        void ExecuteDeferred(std::function<void()> callback) override
+        {
+            std::lock_guard<decltype(_mutex)> lock{_mutex};
+            _deferred.emplace_back(std::move(callback));
+        }
+
+        void RunDeferred()
+        {
+            std::vector<std::function<void()>> deferred;
+            {
+                std::lock_guard<decltype(_mutex)> lock{_mutex};
+                std::swap(deferred, _deferred);
+            }
+            for (auto& callback : deferred)
+            {
+                callback();
+            }
+        }
+
+    private:
+        std::mutex _mutex;
+        std::vector<std::function<void()>> _deferred;
+    };
+
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+
+    DeferringParticipant mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    LogMsg msg;
+    msg.logger_name = "Logger";
+    msg.level = Level::Info;
+    msg.payload = std::string{"deferred"};
+
+    // The flush timer does not send the batch itself
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, A<const LogMsgBatch&>())).Times(0);
+    logMsgSender.SendLogMsg(msg);
+    std::this_thread::sleep_for(LogMsgSender::FlushInterval * 4);
+    Mock::VerifyAndClearExpectations(&mockParticipant);
+
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, ALogMsgBatchWith("Logger", Level::Info, "deferred")))
+        .Times(1);
+    mockParticipant.RunDeferred();
+    Mock::VerifyAndClearExpectations(&mockParticipant);
+
+    logMsgSender.DisableBatching();
 }
 
 TEST(Test_Logger, send_log_message_from_logger)
@@ -124,18 +254,86 @@ TEST(Test_Logger, send_log_message_from_logger)
     std::string payload{"Test log message"};
 
     EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender,
-        ALogMsgWith(loggerName, Level::Info, payload)))
+        ALogMsgBatchWith(loggerName, Level::Info, payload)))
         .Times(1);
 
     logger.Info(payload);
+    logMsgSender.Flush();
 
     EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender,
-        ALogMsgWith(loggerName, Level::Critical, payload)))
+        ALogMsgBatchWith(loggerName, Level::Critical, payload)))
         .Times(1);
 
     logger.Critical(payload);
 }
 
+TEST(Test_Logger, asynchronous_logger_writes_all_messages_in_order)
+{
+    Config::Logging config;
+    config.asynchronous = true;
+    auto sink = Config::Sink{};
+    sink.level = Level::Debug;
+    sink.type = Config::Sink::Type::Stdout;
+    config.sinks.push_back(sink);
+
+    testing::internal::CaptureStdout();
+    {
+        Logger logger{"AsyncLogger", config};
+        for (auto i = 0; i < 100; ++i)
+        {
+            logger.Debug("Message " + std::to_string(i) + ";");
+        }
+        logger.Trace("Filtered message");
+        // destroying the logger writes all queued messages
+    }
+    const auto output = testing::internal::GetCapturedStdout();
+
+    size_t position{0};
+    for (auto i = 0; i < 100; ++i)
+    {
+        const auto found = output.find("Message " + std::to_string(i) + ";", position);
+        ASSERT_NE(found, std::string::npos) << "Message " << i << " is missing or out of order";
+        position = found;
+    }
+    EXPECT_EQ(output.find("Filtered message"), std::string::npos);
+}
+
+TEST(Test_Logger, asynchronous_logger_sends_remote_messages_on_calling_thread)
+{
+    std::string loggerName{"ParticipantAndLogger"};
+
+    Config::Logging config;
+    config.asynchronous = true;
+    auto remoteSink = Config::Sink{};
+    remoteSink.level = Level::Info;
+    remoteSink.type = Config::Sink::Type::Remote;
+    auto stdoutSink = Config::Sink{};
+    stdoutSink.level = Level::Off;
+    stdoutSink.type = Config::Sink::Type::Stdout;
+    config.sinks.push_back(remoteSink);
+    config.sinks.push_back(stdoutSink);
+
+    Logger logger{loggerName, config};
+
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+    MockParticipant mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    logger.RegisterRemoteLogging([&logMsgSender](LogMsg logMsg) {
+        logMsgSender.SendLogMsg(std::move(logMsg));
+    });
+
+    std::string payload{"Test log message"};
+
+    // Errors are not batched, so they are sent before the call returns
+    EXPECT_CALL(mockParticipant, SendMsg(&logMsgSender, ALogMsgBatchWith(loggerName, Level::Error, payload)))
+        .Times(1);
+
+    logger.Error(payload);
+    Mock::VerifyAndClearExpectations(&mockParticipant);
+}
+
 TEST(Test_Logger, get_log_level)
 {
     std::string loggerName{"ParticipantAndLogger"};
@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <limits>
+
 #include "gtest/gtest.h"
 
 #include "LoggingSerdes.hpp"
@@ -39,3 +41,35 @@ TEST(Test_LoggingSerdes, LoggingSerdes)
     Deserialize(buffer, out);
     ASSERT_EQ(in, out);
 }
+
+TEST(Test_LoggingSerdes, LogMsgBatchSerdes)
+{
+    SilKit::Core::MessageBuffer buffer;
+    SilKit::Services::Logging::LogMsgBatch in, out;
+
+    for (auto i = 0u; i < 4; ++i)
+    {
+        SilKit::Services::Logging::LogMsg msg;
+        msg.logger_name = (i % 2 == 0) ? "Participant1" : "Participant2";
+        msg.level = SilKit::Services::Logging::Level::Debug;
+        msg.source.filename = "somefile.txt";
+        msg.source.funcname = "TEST(LogMsgBatchSerdes)";
+        msg.source.line = 15 + i;
+        msg.payload = "Hello, logger " + std::to_string(i) + "!";
+        in.messages.push_back(msg);
+    }
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+    ASSERT_EQ(in, out);
+}
+
+TEST(Test_LoggingSerdes, LogMsgBatchWithInvalidCount)
+{
+    SilKit::Core::MessageBuffer buffer;
+    SilKit::Services::Logging::LogMsgBatch out;
+
+    // a batch which announces far more messages than the buffer holds fails at the end of the buffer
+    buffer << std::vector<std::string>{"Participant1"} << std::numeric_limits<uint32_t>::max();
+    EXPECT_THROW(Deserialize(buffer, out), SilKit::Core::end_of_buffer);
+}
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <algorithm>
 #include <ctime>
 #include <iomanip> //std:put_time
+#include <limits>
 
 #include "silkit/services/orchestration/string_utils.hpp"
 
@@ -30,6 +31,21 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ILogger.hpp"
 #include "LifecycleService.hpp"
 #include "OrchestrationDatatypes.hpp"
+#include "Assert.hpp"
+
+namespace {
+
+constexpr size_t InvalidStateCountIndex{std::numeric_limits<size_t>::max()};
+
+//! The values of the ParticipantState are multiples of 10. Other values, e.g., received from a participant of a newer
+//! version, yield InvalidStateCountIndex and are not counted.
+constexpr auto StateCountIndex(SilKit::Services::Orchestration::ParticipantState state) -> size_t
+{
+    const auto value = static_cast<size_t>(state);
+    return value % 10 == 0 ? value / 10 : InvalidStateCountIndex;
+}
+
+} // namespace
 
 namespace SilKit {
 namespace Services {
@@ -53,18 +69,25 @@ void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/,
 void SystemMonitor::UpdateRequiredParticipantNames(const std::vector<std::string>& requiredParticipantNames)
 {
 
-    _requiredParticipantNames = requiredParticipantNames;
-
     bool allRequiredParticipantsKnown = true;
-    // Init new participants in status map
-    for (auto&& name : _requiredParticipantNames)
     {
         std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
 
-        auto&& statusIter = _participantStatus.find(name);
-        if (statusIter == _participantStatus.end())
+        _requiredParticipantNames = requiredParticipantNames;
+        _requiredParticipantNameSet = {_requiredParticipantNames.begin(), _requiredParticipantNames.end()};
+
+        // Recount the states of the required participants
+        _requiredParticipantStateCounts.fill(0);
+        for (auto&& name : _requiredParticipantNameSet)
         {
-            allRequiredParticipantsKnown = false;
+            auto&& statusIter = _participantStatus.find(name);
+            if (statusIter == _participantStatus.end())
+            {
+                allRequiredParticipantsKnown = false;
+                continue;
+            }
+
+            CountRequiredParticipantState(name, statusIter->second.state, +1);
         }
     }
 
@@ -184,6 +207,7 @@ void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/, const Orchestra
         initialStatus.participantName = participantName;
         initialStatus.state = Orchestration::ParticipantState::Invalid;
         _participantStatus.emplace(participantName, initialStatus);
+        CountRequiredParticipantState(participantName, initialStatus.state, +1);
     }
 
     // Save former state
@@ -205,7 +229,10 @@ void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/, const Orchestra
     // Update status map
     {
         std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
-        _participantStatus.at(participantName) = newParticipantStatus;
+        auto& participantStatus = _participantStatus.at(participantName);
+        CountRequiredParticipantState(participantName, participantStatus.state, -1);
+        participantStatus = newParticipantStatus;
+        CountRequiredParticipantState(participantName, participantStatus.state, +1);
     }
 
     // On new participant state
@@ -332,6 +359,7 @@ void SystemMonitor::OnParticipantDisconnected(const ParticipantConnectionInforma
         auto it = _participantStatus.find(participantConnectionInformation.participantName);
         if (it != _participantStatus.end())
         {
+            CountRequiredParticipantState(it->first, it->second.state, -1);
             _participantStatus.erase(it);
         }
     }
@@ -345,28 +373,46 @@ void SystemMonitor::OnParticipantDisconnected(const ParticipantConnectionInforma
 
 bool SystemMonitor::AllRequiredParticipantsInState(std::initializer_list<Orchestration::ParticipantState> acceptedStates) const
 {
-    for (auto&& name : _requiredParticipantNames)
+    // Required participants which have been removed from _participantStatus are not counted in any state. This also
+    // blocks any SystemState updates if a required participant has disconnected.
+    std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
+
+    size_t numberOfParticipantsInAcceptedStates{0};
+    for (auto&& acceptedState : acceptedStates)
     {
-        // Check if required participant hasn't been removed from _participantStatus map.
-        // This also blocks any SystemState updates if a required participant has disconnected and thus removed from _participantStatus.
-        auto&& it = _participantStatus.find(name);
-        if (it == _participantStatus.end())
+        const auto index = StateCountIndex(acceptedState);
+        SILKIT_ASSERT(index < _requiredParticipantStateCounts.size());
+        if (index < _requiredParticipantStateCounts.size())
         {
-            return false;
+            numberOfParticipantsInAcceptedStates += _requiredParticipantStateCounts[index];
         }
+    }
+    return numberOfParticipantsInAcceptedStates == _requiredParticipantNameSet.size();
+}
 
-        auto participantState = [this, &name] {
-            std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
-            return _participantStatus.at(name).state;
-        }();
+void SystemMonitor::CountRequiredParticipantState(const std::string& participantName,
+                                                  Orchestration::ParticipantState state, int delta)
+{
+    static_assert(StateCountIndex(Orchestration::ParticipantState::Aborting)
+                      < std::tuple_size<decltype(_requiredParticipantStateCounts)>::value,
+                  "every ParticipantState must have a count");
+
+    // out-of-range states are neither counted when entered nor when left, so the counts stay consistent
+    const auto index = StateCountIndex(state);
+    if (index >= _requiredParticipantStateCounts.size()
+        || _requiredParticipantNameSet.find(participantName) == _requiredParticipantNameSet.end())
+    {
+        return;
+    }
 
-        bool isAcceptedState = std::any_of(begin(acceptedStates), end(acceptedStates), [participantState](auto acceptedState) {
-            return participantState == acceptedState;
-        });
-        if (!isAcceptedState)
-            return false;
+    if (delta < 0)
+    {
+        _requiredParticipantStateCounts[index] -= static_cast<size_t>(-delta);
+    }
+    else
+    {
+        _requiredParticipantStateCounts[index] += static_cast<size_t>(delta);
     }
-    return true;
 }
 
 void SystemMonitor::ValidateParticipantStatusUpdate(const Orchestration::ParticipantStatus& newStatus, Orchestration::ParticipantState oldState)
@@ -450,8 +496,7 @@ void SystemMonitor::ValidateParticipantStatusUpdate(const Orchestration::Partici
 
 void SystemMonitor::UpdateSystemState(const Orchestration::ParticipantStatus& newStatus)
 {
-    auto&& nameIter = std::find(_requiredParticipantNames.begin(), _requiredParticipantNames.end(), newStatus.participantName);
-    if (nameIter == _requiredParticipantNames.end())
+    if (_requiredParticipantNameSet.find(newStatus.participantName) == _requiredParticipantNameSet.end())
     {
         return;
     }
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
 #include <unordered_set>
@@ -110,6 +111,9 @@ private:
     // ----------------------------------------
     // private methods
     bool AllRequiredParticipantsInState(std::initializer_list<Orchestration::ParticipantState> acceptedStates) const;
+    //! Count the state change of a participant, if it is required. Must be called with _participantStatusMx held.
+    void CountRequiredParticipantState(const std::string& participantName, Orchestration::ParticipantState state,
+                                       int delta);
     void ValidateParticipantStatusUpdate(const Orchestration::ParticipantStatus& newStatus, Orchestration::ParticipantState oldState);
     void UpdateSystemState(const Orchestration::ParticipantStatus& newStatus);
     inline void SetSystemState(Orchestration::SystemState newState);
@@ -122,6 +126,9 @@ private:
     Core::IParticipantInternal* _participant{nullptr};
 
     std::vector<std::string> _requiredParticipantNames{};
+    std::unordered_set<std::string> _requiredParticipantNameSet{};
+    //! Number of required participants in _participantStatus per ParticipantState (indexed by state value / 10)
+    std::array<size_t, 13> _requiredParticipantStateCounts{};
 
     mutable std::mutex _systemStateMx;
     mutable std::mutex _participantStatusMx;
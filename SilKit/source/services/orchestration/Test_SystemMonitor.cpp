@@ -714,6 +714,86 @@ TEST_F(Test_SystemMonitor, DISABLED_detect_initialized_after_invalid)
     EXPECT_EQ(monitor.SystemState(), SystemState::CommunicationInitialized);
 }
 
+TEST_F(Test_SystemMonitor, repeated_status_of_a_participant_is_counted_once)
+{
+    SetParticipantStatus(1, ParticipantState::ServicesCreated);
+    SetParticipantStatus(1, ParticipantState::ServicesCreated);
+    SetParticipantStatus(2, ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Invalid);
+
+    SetParticipantStatus(3, ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+}
+
+TEST_F(Test_SystemMonitor, participant_leaving_a_state_is_no_longer_counted_in_it)
+{
+    SetAllParticipantStates(ParticipantState::ServicesCreated);
+    SetAllParticipantStates(ParticipantState::CommunicationInitializing);
+    SetAllParticipantStates(ParticipantState::CommunicationInitialized);
+    SetAllParticipantStates(ParticipantState::ReadyToRun);
+    SetAllParticipantStates(ParticipantState::Running);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Running);
+
+    // P1 left Running, the other participants pausing must not complete the Paused state
+    SetParticipantStatus(1, ParticipantState::Stopping);
+    SetParticipantStatus(2, ParticipantState::Paused);
+    SetParticipantStatus(3, ParticipantState::Paused);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Stopping);
+}
+
+TEST_F(Test_SystemMonitor, disconnected_participant_is_no_longer_counted)
+{
+    SetAllParticipantStates(ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+
+    // losing the connection reports the participant as Error and then forgets it
+    monitor.OnParticipantDisconnected(ParticipantConnectionInformation{"P3"});
+    EXPECT_EQ(monitor.SystemState(), SystemState::Error);
+    EXPECT_THROW(monitor.ParticipantStatus("P3"), SilKitError);
+
+    // the remaining participants alone do not complete the next state
+    SetParticipantStatus(1, ParticipantState::CommunicationInitializing);
+    SetParticipantStatus(2, ParticipantState::CommunicationInitializing);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Error);
+}
+
+TEST_F(Test_SystemMonitor, update_required_participants_after_receiving_their_status)
+{
+    SetParticipantStatus(1, ParticipantState::ServicesCreated);
+    SetParticipantStatus(2, ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Invalid);
+
+    // the states of the already known participants are counted for the new set of required participants
+    monitor.UpdateRequiredParticipantNames({"P1", "P2"});
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+
+    SetParticipantStatus(1, ParticipantState::CommunicationInitializing);
+    SetParticipantStatus(2, ParticipantState::CommunicationInitializing);
+    EXPECT_EQ(monitor.SystemState(), SystemState::CommunicationInitializing);
+
+    // P3 is required again, but has not sent any status yet
+    monitor.UpdateRequiredParticipantNames({"P1", "P2", "P3"});
+    SetParticipantStatus(1, ParticipantState::CommunicationInitialized);
+    SetParticipantStatus(2, ParticipantState::CommunicationInitialized);
+    EXPECT_EQ(monitor.SystemState(), SystemState::CommunicationInitializing);
+}
+
+TEST_F(Test_SystemMonitor, out_of_range_participant_state_is_not_counted)
+{
+    // 15 must not be counted as ServicesCreated (10), 250 is beyond all states
+    SetParticipantStatus(3, static_cast<ParticipantState>(15));
+    SetParticipantStatus(1, ParticipantState::ServicesCreated);
+    SetParticipantStatus(2, ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Invalid);
+
+    SetParticipantStatus(3, static_cast<ParticipantState>(250));
+    SetParticipantStatus(1, ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::Invalid);
+
+    SetParticipantStatus(3, ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+}
+
 TEST_F(Test_SystemMonitor, check_on_partitipant_connected_triggers_callback)
 {
     monitor.SetParticipantConnectedHandler([this](const ParticipantConnectionInformation& participantInformation) {
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "TimeConfiguration.hpp"
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+using namespace std::chrono_literals;
+using SilKit::Services::Orchestration::NextSimTask;
+using SilKit::Services::Orchestration::TimeConfiguration;
+
+
+auto MakeNextSimTask(std::chrono::nanoseconds timePoint) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = 1ms;
+    return task;
+}
+
+
+TEST(Test_TimeConfiguration, lowest_other_time_point_blocks_advancing)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    configuration.AddSynchronizedParticipant("P3");
+
+    configuration.AdvanceTimeStep();
+    ASSERT_EQ(configuration.NextSimStep().timePoint, 1ms);
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(3ms));
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(0ms));
+    configuration.OnReceiveNextSimStep("P3", MakeNextSimTask(2ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(1ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep();
+    ASSERT_EQ(configuration.NextSimStep().timePoint, 2ms);
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(4ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, removed_participants_do_not_block_advancing)
+{
+    TimeConfiguration configuration{nullptr};
+    for (const auto& name : {"P1", "P2", "P3", "P4", "P5"})
+    {
+        configuration.AddSynchronizedParticipant(name);
+    }
+
+    configuration.AdvanceTimeStep();
+    ASSERT_EQ(configuration.NextSimStep().timePoint, 1ms);
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(5ms));
+    configuration.OnReceiveNextSimStep("P2", MakeNextSimTask(0ms));
+    configuration.OnReceiveNextSimStep("P3", MakeNextSimTask(3ms));
+    configuration.OnReceiveNextSimStep("P4", MakeNextSimTask(0ms));
+    configuration.OnReceiveNextSimStep("P5", MakeNextSimTask(1ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    EXPECT_TRUE(configuration.RemoveSynchronizedParticipant("P2"));
+    EXPECT_FALSE(configuration.RemoveSynchronizedParticipant("P2"));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    EXPECT_TRUE(configuration.RemoveSynchronizedParticipant("P4"));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // the remaining participants are still tracked correctly after the removals
+    configuration.OnReceiveNextSimStep("P5", MakeNextSimTask(7ms));
+    configuration.OnReceiveNextSimStep("P3", MakeNextSimTask(6ms));
+    configuration.AdvanceTimeStep();
+    configuration.AdvanceTimeStep();
+    configuration.AdvanceTimeStep();
+    configuration.AdvanceTimeStep();
+    configuration.AdvanceTimeStep();
+    ASSERT_EQ(configuration.NextSimStep().timePoint, 6ms);
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeNextSimTask(8ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    const auto names = configuration.GetSynchronizedParticipantNames();
+    EXPECT_EQ(names.size(), 3u);
+}
+
+
+} // namespace
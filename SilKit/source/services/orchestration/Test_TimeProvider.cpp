@@ -69,4 +69,24 @@ TEST(Test_TimeProvider, check_handlers)
 	ASSERT_EQ(invocationCount, 1) << "Only the first SetTime should trigger the handler";
 
 }
+
+TEST(Test_TimeProvider, check_now_follows_configured_provider)
+{
+	TimeProvider timeProvider{};
+	ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+
+	timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+	ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+	timeProvider.SetTime(5ms, 1ms);
+	ASSERT_EQ(timeProvider.Now(), 5ms);
+
+	timeProvider.ConfigureTimeProvider(TimeProviderKind::WallClock);
+	ASSERT_GT(timeProvider.Now(), 0ns);
+	timeProvider.SetTime(7ms, 1ms); // ignored by the wall clock
+	ASSERT_NE(timeProvider.Now(), 7ms);
+
+	// the virtual time does not survive re-configuring
+	timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+	ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+}
 } // namespace
@@ -19,8 +19,11 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -40,70 +43,22 @@ using namespace testing;
 using namespace SilKit;
 using namespace SilKit::Services::Orchestration;
 
-class LimitedMockClock : public WatchDog::IClock
+//! Advances by a fixed tick on every read and counts the reads
+class CountingClock : public WatchDog::IClock
 {
 public:
-    explicit LimitedMockClock(std::chrono::nanoseconds limit, std::chrono::nanoseconds tick = 1ms)
-        : _limitRep{static_cast<std::chrono::nanoseconds>(limit).count()}
-        , _tick{tick}
+    explicit CountingClock(std::chrono::nanoseconds tick = 1ms)
+        : _tick{tick}
     {
     }
 
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        _now += _tick;
-
-        // set the flag that the limit has been reached (but only _once_, otherwise an exception is thrown)
-        if (_now >= GetLimit())
-        {
-            if (!_limitReachedFlagged.exchange(true))
-            {
-                _limitReached.set_value();
-            }
-        }
-
-        return _now;
-    }
-
-    /// This function waits until either, the mock time has reached the current limit, or, the wall-clock timeout has
-    /// been reached.
-    ///
-    /// \param wallClockTimeout How long this function should wait for the limit to be reached
-    /// \return true if the limit was reached, false if the wall-clock timeout was reached
-    bool WaitUntilLimitReachedFor(std::chrono::nanoseconds wallClockTimeout)
-    {
-        const auto status = _limitReached.get_future().wait_for(wallClockTimeout);
-        return status == std::future_status::ready;
-    }
-
-    /// Advances the limit and resets the reached flag. Therefore WaitUntilLimitReachedFor can be called again
-    /// afterwards, even if the limit had been reached before.
-    ///
-    /// \param advance By how much the current limit should be advanced
-    void AdvanceLimitBy(std::chrono::nanoseconds advance)
-    {
-        _limitRep += static_cast<std::chrono::nanoseconds>(advance).count();
-
-        if (_limitReachedFlagged)
-        {
-            _limitReached = {};
-            _limitReachedFlagged = false;
-        }
-    }
+    auto Now() const -> std::chrono::nanoseconds override { return ++_numReads * _tick; }
 
-private:
-    auto GetLimit() const -> std::chrono::nanoseconds { return std::chrono::nanoseconds{_limitRep}; }
+    auto NumReads() const -> int { return _numReads; }
 
 private:
-    std::atomic<std::chrono::nanoseconds::rep> _limitRep;
     std::chrono::nanoseconds _tick;
-
-    // stores the current mock-time
-    mutable std::chrono::nanoseconds _now{};
-    // true if the promise has already been set
-    mutable std::atomic<bool> _limitReachedFlagged{false};
-    // will be set once (!) if _now is greater or equal to _limit
-    mutable std::promise<void> _limitReached{};
+    mutable std::atomic<int> _numReads{0};
 };
 
 class Test_WatchDog : public testing::Test
@@ -113,8 +68,6 @@ protected:
     {
         MOCK_METHOD1(WarnHandler, void(std::chrono::milliseconds));
         MOCK_METHOD1(ErrorHandler, void(std::chrono::milliseconds));
-
-        MOCK_METHOD(void, SequencePoint, ());
     };
 
 protected:
@@ -124,6 +77,19 @@ protected:
     // ----------------------------------------
     // Helper Methods
 
+    //! Returns an action for a handler expectation which fulfills the promise
+    static auto Fulfills(std::promise<void>& promise) -> std::function<void(std::chrono::milliseconds)>
+    {
+        return [&promise](std::chrono::milliseconds) {
+            promise.set_value();
+        };
+    }
+
+    static bool IsReady(std::future<void>& future, std::chrono::milliseconds timeout)
+    {
+        return future.wait_for(timeout) == std::future_status::ready;
+    }
+
 protected:
     // ----------------------------------------
     // Members
@@ -137,11 +103,8 @@ protected:
 // IMPORTANT: Set expectations (EXPECT_CALL) before the call to watchDog.Start()!
 // ================================================================================
 //
-// Note: The watchdog is running in a separate thread in the background and
-//       uses the wall clock for periodic checks. It is possible that
-//       scheduling might lead to test failures in rare cases. To make the
-//       tests entirely deterministic, this stepping must be refactored out
-//       of the watchdog into it's own interface as well.
+// Note: The checks are executed on the callback threads of the timer service at the wall-clock deadlines, the injected
+//       clock only determines the reported durations.
 
 TEST_F(Test_WatchDog, throw_if_warn_timeout_is_zero)
 {
@@ -155,88 +118,148 @@ TEST_F(Test_WatchDog, throw_if_error_timeout_is_zero)
 
 TEST_F(Test_WatchDog, warn_after_timeout)
 {
-    LimitedMockClock mockClock{50ms, 2ms};
+    std::promise<void> warned;
+    auto isWarned = warned.get_future();
 
-    WatchDog watchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    WatchDog watchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}};
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, WarnHandler(Ge(10ms))).WillOnce(Invoke(Fulfills(warned)));
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isWarned, WAIT_EXPECT_READY));
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, error_after_timeout)
 {
-    LimitedMockClock mockClock{100ms, 5ms};
+    std::promise<void> failed;
+    auto isFailed = failed.get_future();
 
-    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &mockClock};
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}};
 
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(Ge(50ms))).WillOnce(Invoke(Fulfills(failed)));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isFailed, WAIT_EXPECT_READY));
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, warn_only_once)
 {
-    LimitedMockClock mockClock{100ms, 10ms};
+    std::promise<void> warned;
+    auto isWarned = warned.get_future();
 
-    WatchDog watchDog{Config::HealthCheck{20ms, std::chrono::milliseconds::max()}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}};
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, WarnHandler(_)).WillOnce(Invoke(Fulfills(warned)));
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isWarned, WAIT_EXPECT_READY));
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, error_only_once)
 {
-    LimitedMockClock mockClock{100ms, 10ms};
+    std::promise<void> failed;
+    auto isFailed = failed.get_future();
 
-    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &mockClock};
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{{}, 10ms}};
 
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).WillOnce(Invoke(Fulfills(failed)));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isFailed, WAIT_EXPECT_READY));
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, no_callback_if_reset_in_time)
 {
-    LimitedMockClock mockClock{1s, 100ms};
+    CountingClock clock;
 
-    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{20ms, 30ms}, &clock};
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
+    watchDog.Reset();
+
+    // the deadlines of the cancelled checks pass without the clock being read
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    EXPECT_EQ(clock.NumReads(), 1);
+}
+
+TEST_F(Test_WatchDog, clock_is_only_read_when_a_step_starts_and_at_the_deadlines)
+{
+    CountingClock clock{7ms};
+
+    WatchDog watchDog{Config::HealthCheck{20ms, 40ms}, &clock};
 
-    // After being started, the watchdog will ask the clock for the current time periodically. This will advance the
-    // mock time each time and eventually the limit will be reached.
+    std::promise<void> failed;
+    auto isFailed = failed.get_future();
+
+    // the reported durations are measured from the read when the step started
+    EXPECT_CALL(callbacks, WarnHandler(7ms)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(14ms)).WillOnce(Invoke(Fulfills(failed)));
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+
+    // steps which finish in time only read the clock when they start
+    for (int step = 0; step < 1000; ++step)
+    {
+        watchDog.Start();
+        watchDog.Reset();
+    }
+    EXPECT_EQ(clock.NumReads(), 1000);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-    mockClock.AdvanceLimitBy(1s);
+    // nothing is read between the steps
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    EXPECT_EQ(clock.NumReads(), 1000);
 
+    // a step which exceeds both timeouts reads the clock once more at each of them
+    watchDog.Start();
+    ASSERT_TRUE(IsReady(isFailed, WAIT_EXPECT_READY));
     watchDog.Reset();
 
-    // After being reset, the watchdog will not ask the clock for the current time anymore. Since the mock time only
-    // advances when the watchdog asks for it, the new limit will never be reached.
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    EXPECT_EQ(clock.NumReads(), 1003);
+}
+
+TEST_F(Test_WatchDog, handlers_are_called_again_in_later_steps)
+{
+    std::promise<void> failedFirst;
+    auto isFailedFirst = failedFirst.get_future();
+    std::promise<void> failedSecond;
+    auto isFailedSecond = failedSecond.get_future();
+
+    WatchDog watchDog{Config::HealthCheck{{}, 10ms}};
+
+    EXPECT_CALL(callbacks, ErrorHandler(_))
+        .WillOnce(Invoke(Fulfills(failedFirst)))
+        .WillOnce(Invoke(Fulfills(failedSecond)));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+
+    watchDog.Start();
+    ASSERT_TRUE(IsReady(isFailedFirst, WAIT_EXPECT_READY));
+    watchDog.Reset();
 
-    // The wall-clock timeout is deliberately chosen rather small since it should be reached.
-    ASSERT_FALSE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_TIMEOUT));
+    watchDog.Start();
+    ASSERT_TRUE(IsReady(isFailedSecond, WAIT_EXPECT_READY));
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, create_health_check_unconfigured)
@@ -258,98 +281,111 @@ TEST_F(Test_WatchDog, create_health_check_unconfigured)
 
 TEST_F(Test_WatchDog, create_health_check_configured)
 {
-    LimitedMockClock mockClock{1000ms, 250ms};
-
-    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}};
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
     watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, nothing_without_soft_and_hard)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
+    CountingClock clock;
 
-    WatchDog watchDog{Config::HealthCheck{{}, {}}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{{}, {}}, &clock};
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    // without any timeout, no check is scheduled and the clock is never read
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    watchDog.Reset();
+    EXPECT_EQ(clock.NumReads(), 0);
 }
 
 TEST_F(Test_WatchDog, warn_with_soft_without_hard)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
+    std::promise<void> warned;
+    auto isWarned = warned.get_future();
 
-    WatchDog watchDog{Config::HealthCheck{100ms, {}}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{10ms, {}}};
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, WarnHandler(_)).WillOnce(Invoke(Fulfills(warned)));
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isWarned, WAIT_EXPECT_READY));
+    std::this_thread::sleep_for(WAIT_EXPECT_TIMEOUT);
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, error_with_hard_without_soft)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
+    std::promise<void> failed;
+    auto isFailed = failed.get_future();
 
-    WatchDog watchDog{Config::HealthCheck{{}, 100ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    WatchDog watchDog{Config::HealthCheck{{}, 10ms}};
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).WillOnce(Invoke(Fulfills(failed)));
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
     watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isFailed, WAIT_EXPECT_READY));
+    watchDog.Reset();
 }
 
 TEST_F(Test_WatchDog, warn_and_error_with_soft_and_hard)
 {
-    LimitedMockClock mockClock{150ms, 10ms};
+    std::promise<void> failed;
+    auto isFailed = failed.get_future();
+
+    WatchDog watchDog{Config::HealthCheck{10ms, 30ms}};
 
-    WatchDog watchDog{Config::HealthCheck{100ms, 200ms}, &mockClock};
+    {
+        InSequence sequence;
+        EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+        EXPECT_CALL(callbacks, ErrorHandler(_)).WillOnce(Invoke(Fulfills(failed)));
+    }
     watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
     watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
-    // NB: It is undefined behavior to interleave setting expectations and calling mock methods.
+    watchDog.Start();
 
-    // The expectations on WarnHandler and ErrorHandler are partially ordered. The explicit call to SequencePoint
-    // separates two sets of expectations.
-    testing::Sequence warnSequence, errorSequence;
+    ASSERT_TRUE(IsReady(isFailed, WAIT_EXPECT_READY));
+    watchDog.Reset();
+}
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1).InSequence(warnSequence);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0).InSequence(errorSequence);
-    EXPECT_CALL(callbacks, SequencePoint()).Times(1).InSequence(warnSequence, errorSequence);
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0).InSequence(warnSequence);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1).InSequence(errorSequence);
+TEST_F(Test_WatchDog, no_warning_if_it_would_not_come_before_the_error)
+{
+    std::promise<void> failed;
+    auto isFailed = failed.get_future();
 
-    watchDog.Start();
+    WatchDog watchDog{Config::HealthCheck{10ms, 10ms}};
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-    callbacks.SequencePoint();
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).WillOnce(Invoke(Fulfills(failed)));
+    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
 
-    mockClock.AdvanceLimitBy(100ms);
+    watchDog.Start();
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    ASSERT_TRUE(IsReady(isFailed, WAIT_EXPECT_READY));
+    watchDog.Reset();
 }
 
 } // anonymous namespace
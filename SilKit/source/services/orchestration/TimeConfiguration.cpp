@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "TimeConfiguration.hpp"
 #include "ILogger.hpp"
 
+#include <utility>
+
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
@@ -44,7 +46,7 @@ void TimeConfiguration::SetBlockingMode(bool blocking)
 void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherParticipantIndices.find(otherParticipantName) != _otherParticipantIndices.end())
     {
         // ignore already known participants
         return;
@@ -52,17 +54,22 @@ void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParti
     NextSimTask task;
     task.timePoint = -1ns;
     task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+
+    const auto index = _otherParticipants.size();
+    _otherParticipants.push_back(OtherParticipant{otherParticipantName, task, _otherNextTimePointHeap.size()});
+    _otherParticipantIndices.emplace(otherParticipantName, index);
+    _otherNextTimePointHeap.push_back(index);
+    HeapSiftUp(_otherParticipants[index].heapPosition);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    auto it = _otherParticipantIndices.find(otherParticipantName);
+    if (it != _otherParticipantIndices.end())
     {
-        _otherNextTasks.erase(it);
+        RemoveOtherParticipant(it->second);
         return true;
     }
     return false;
@@ -71,9 +78,9 @@ bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherPa
 auto TimeConfiguration::GetSynchronizedParticipantNames() -> std::vector<std::string>
 {
     std::vector<std::string> participantNames;
-    for (auto const& it : _otherNextTasks)
+    for (auto const& otherParticipant : _otherParticipants)
     {
-        participantNames.push_back(it.first);
+        participantNames.push_back(otherParticipant.name);
     }
     return participantNames;
 }
@@ -82,38 +89,49 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 {
     Lock lock{_mx};
 
-    auto&& itOtherNextTask = _otherNextTasks.find(participantName);
-    if (itOtherNextTask == _otherNextTasks.end())
+    auto&& itOtherParticipant = _otherParticipantIndices.find(participantName);
+    if (itOtherParticipant == _otherParticipantIndices.end())
     {
         Logging::Error(_logger, "Received NextSimTask from unknown participant {}", participantName);
         return;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    auto& otherParticipant = _otherParticipants[itOtherParticipant->second];
+    const auto isLowerTimePoint = nextStep.timePoint < otherParticipant.nextTask.timePoint;
+    if (isLowerTimePoint)
     {
         Logging::Error(_logger,
                        "Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
                        "known timePoint {}",
-                       participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count());
+                       participantName, nextStep.timePoint.count(), otherParticipant.nextTask.timePoint.count());
+    }
+
+    otherParticipant.nextTask = std::move(nextStep);
+    if (isLowerTimePoint)
+    {
+        HeapSiftUp(otherParticipant.heapPosition);
+    }
+    else
+    {
+        HeapSiftDown(otherParticipant.heapPosition);
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
-    Logging::Debug(_logger, "Updated _otherNextTasks for participant {} with time {}", participantName,
-                   nextStep.timePoint.count());
+    Logging::Debug(_logger, "Updated next task of participant {} with time {}", participantName,
+                   otherParticipant.nextTask.timePoint.count());
 }
 
 void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherParticipantIndices.find(otherParticipantName) != _otherParticipantIndices.end())
     {
         const std::string errorMessage{"Participant " + otherParticipantName + " unknown."};
         throw SilKitError{errorMessage};
     }
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    auto it = _otherParticipantIndices.find(otherParticipantName);
+    if (it != _otherParticipantIndices.end())
     {
-        _otherNextTasks.erase(it);
+        RemoveOtherParticipant(it->second);
     }
 }
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
@@ -145,14 +163,17 @@ bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    if (_otherNextTimePointHeap.empty())
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
-        {
-            Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                  otherTask.second.timePoint.count());
-            return true;
-        }
+        return false;
+    }
+
+    const auto& lowestOther = _otherParticipants[_otherNextTimePointHeap.front()];
+    if (_myNextTask.timePoint > lowestOther.nextTask.timePoint)
+    {
+        Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", lowestOther.name,
+              lowestOther.nextTask.timePoint.count());
+        return true;
     }
     return false;
 }
@@ -181,15 +202,16 @@ bool TimeConfiguration::HandleHopOn()
         if (_currentTask.timePoint == -1ns) // On initial time
         {
             std::chrono::nanoseconds minimalOtherTime = std::chrono::nanoseconds::max();
-            for (const auto& otherTask : _otherNextTasks)
+            for (const auto& otherParticipant : _otherParticipants)
             {
+                const auto& otherTask = otherParticipant.nextTask;
                 // Any other participant has already advanced further that its duration -> HopOn
-                if (otherTask.second.timePoint > otherTask.second.duration)
+                if (otherTask.timePoint > otherTask.duration)
                 {
                     _hoppedOn = true;
-                    if (otherTask.second.timePoint < minimalOtherTime)
+                    if (otherTask.timePoint < minimalOtherTime)
                     {
-                        minimalOtherTime = otherTask.second.timePoint;
+                        minimalOtherTime = otherTask.timePoint;
                     }
                 }
             }
@@ -205,6 +227,86 @@ bool TimeConfiguration::HandleHopOn()
     return false;
 }
 
+void TimeConfiguration::RemoveOtherParticipant(size_t index)
+{
+    // remove the participant from the heap by replacing it with the last heap entry
+    const auto heapPosition = _otherParticipants[index].heapPosition;
+    const auto lastHeapPosition = _otherNextTimePointHeap.size() - 1;
+    if (heapPosition != lastHeapPosition)
+    {
+        HeapSwap(heapPosition, lastHeapPosition);
+    }
+    _otherNextTimePointHeap.pop_back();
+    if (heapPosition != lastHeapPosition)
+    {
+        HeapSiftUp(heapPosition);
+        HeapSiftDown(heapPosition);
+    }
+
+    // remove the participant from the vector by replacing it with the last participant
+    _otherParticipantIndices.erase(_otherParticipants[index].name);
+    const auto lastIndex = _otherParticipants.size() - 1;
+    if (index != lastIndex)
+    {
+        _otherParticipants[index] = std::move(_otherParticipants[lastIndex]);
+        _otherParticipantIndices[_otherParticipants[index].name] = index;
+        _otherNextTimePointHeap[_otherParticipants[index].heapPosition] = index;
+    }
+    _otherParticipants.pop_back();
+}
+
+auto TimeConfiguration::HeapLess(size_t lhsPosition, size_t rhsPosition) const -> bool
+{
+    return _otherParticipants[_otherNextTimePointHeap[lhsPosition]].nextTask.timePoint
+           < _otherParticipants[_otherNextTimePointHeap[rhsPosition]].nextTask.timePoint;
+}
+
+void TimeConfiguration::HeapSwap(size_t lhsPosition, size_t rhsPosition)
+{
+    std::swap(_otherNextTimePointHeap[lhsPosition], _otherNextTimePointHeap[rhsPosition]);
+    _otherParticipants[_otherNextTimePointHeap[lhsPosition]].heapPosition = lhsPosition;
+    _otherParticipants[_otherNextTimePointHeap[rhsPosition]].heapPosition = rhsPosition;
+}
+
+void TimeConfiguration::HeapSiftUp(size_t position)
+{
+    while (position > 0)
+    {
+        const auto parentPosition = (position - 1) / 2;
+        if (!HeapLess(position, parentPosition))
+        {
+            break;
+        }
+        HeapSwap(position, parentPosition);
+        position = parentPosition;
+    }
+}
+
+void TimeConfiguration::HeapSiftDown(size_t position)
+{
+    const auto size = _otherNextTimePointHeap.size();
+    while (true)
+    {
+        auto lowestPosition = position;
+        const auto leftPosition = 2 * position + 1;
+        const auto rightPosition = leftPosition + 1;
+        if (leftPosition < size && HeapLess(leftPosition, lowestPosition))
+        {
+            lowestPosition = leftPosition;
+        }
+        if (rightPosition < size && HeapLess(rightPosition, lowestPosition))
+        {
+            lowestPosition = rightPosition;
+        }
+        if (lowestPosition == position)
+        {
+            break;
+        }
+        HeapSwap(position, lowestPosition);
+        position = lowestPosition;
+    }
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace SilKit
@@ -21,8 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <string>
 #include <chrono>
-#include <map>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "OrchestrationDatatypes.hpp"
 #include "silkit/services/logging/ILogger.hpp"
@@ -57,12 +58,31 @@ public: //Methods
     // Returns true (only once) in the step the actual hop-on happened
     bool HandleHopOn();
 
+private: //Types
+    struct OtherParticipant
+    {
+        std::string name;
+        NextSimTask nextTask;
+        size_t heapPosition;
+    };
+
+private: //Methods
+    void RemoveOtherParticipant(size_t index);
+    auto HeapLess(size_t lhsPosition, size_t rhsPosition) const -> bool;
+    void HeapSwap(size_t lhsPosition, size_t rhsPosition);
+    void HeapSiftUp(size_t position);
+    void HeapSiftDown(size_t position);
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    // The other participants are stored by index. The min-heap over their next time points contains these indices,
+    // and each participant knows its position in the heap, so that updates and removals are O(log N).
+    std::vector<OtherParticipant> _otherParticipants;
+    std::unordered_map<std::string, size_t> _otherParticipantIndices;
+    std::vector<size_t> _otherNextTimePointHeap;
     bool _blocking;
 
     bool _hoppedOn = false;
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 
 #include "TimeProvider.hpp"
+#include "ILogger.hpp"
 
 #include <mutex>
 
@@ -76,6 +77,13 @@ protected:
         _listener->OnTick(now, duration);
     }
 
+    auto MakeTickErrorHandler() -> Util::TimerService::ErrorHandler
+    {
+        return [this](const std::string& message) {
+            _listener->OnTickError(message);
+        };
+    }
+
 private:
     std::string _name;
     ITimeProviderImplListener* _listener;
@@ -96,13 +104,7 @@ public:
     {
         _timer.WithPeriod(_tickPeriod, [this](const auto& now) {
             NotifyListenerAboutTick(now, _tickPeriod);
-        });
-    }
-
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        const auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-        return now;
+        }, MakeTickErrorHandler());
     }
 
     void SetTime(std::chrono::nanoseconds, std::chrono::nanoseconds) override {}
@@ -125,12 +127,7 @@ public:
     {
         _timer.WithPeriod(_tickPeriod, [this](const auto& now) {
             NotifyListenerAboutTick(now, _tickPeriod);
-        });
-    }
-
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        return DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC;
+        }, MakeTickErrorHandler());
     }
 
     void SetTime(std::chrono::nanoseconds, std::chrono::nanoseconds) override {}
@@ -141,8 +138,8 @@ private:
 };
 
 
-/// A caching time provider: we update its internal state whenever the controller's simulation time changes.
-/// This ensures that the our time provider is available even after the TimeSyncService gets destructed.
+/// A time provider driven by the controller's simulation time. The current time itself is cached by the TimeProvider,
+/// which ensures that it is available even after the TimeSyncService gets destructed.
 class SynchronizedVirtualTimeProvider final : public ProviderBase
 {
 public:
@@ -153,20 +150,11 @@ public:
 
     void OnHandlerAdded() override {}
 
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        return _now;
-    }
-
     void SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) override
     {
-        _now = now;
         // tell our users about the next simulation step
         NotifyListenerAboutTick(now, duration);
     }
-
-private:
-    std::chrono::nanoseconds _now{DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC};
 };
 
 
@@ -175,7 +163,21 @@ private:
 
 TimeProvider::TimeProvider()
     : _currentProvider{std::make_unique<NoSyncProvider>(static_cast<ITimeProviderImplListener&>(*this))}
+    , _virtualNow{DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC.count()}
+{
+}
+
+auto TimeProvider::Now() const -> std::chrono::nanoseconds
 {
+    switch (_currentProviderKind.load(std::memory_order_acquire))
+    {
+    case Orchestration::TimeProviderKind::WallClock:
+        return std::chrono::high_resolution_clock::now().time_since_epoch();
+    case Orchestration::TimeProviderKind::SyncTime:
+        return std::chrono::nanoseconds{_virtualNow.load(std::memory_order_acquire)};
+    default:
+        return DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC;
+    }
 }
 
 void TimeProvider::ConfigureTimeProvider(Orchestration::TimeProviderKind timeProviderKind)
@@ -212,6 +214,10 @@ void TimeProvider::ConfigureTimeProvider(Orchestration::TimeProviderKind timePro
             // swap the newly created provider with the current provider
             swap(_currentProvider, providerPtr);
 
+            // a newly configured synchronized virtual time starts without a valid timestamp
+            _virtualNow.store(DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC.count(), std::memory_order_release);
+            _currentProviderKind.store(timeProviderKind, std::memory_order_release);
+
             _currentProvider->SetActive(true);
         }
     }
@@ -223,6 +229,16 @@ void TimeProvider::OnTick(std::chrono::nanoseconds now, std::chrono::nanoseconds
     _handlers.InvokeAll(now, duration);
 }
 
+void TimeProvider::OnTickError(const std::string& message)
+{
+    Logging::Error(_logger.load(), "TimeProvider: {}", message);
+}
+
+void TimeProvider::SetLogger(Logging::ILogger* logger)
+{
+    _logger.store(logger);
+}
+
 
 } // namespace Orchestration
 } // namespace Services
@@ -21,12 +21,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <memory>
 #include <mutex>
 
 #include "ITimeProvider.hpp"
+#include "silkit/services/logging/fwd_decl.hpp"
 #include "Timer.hpp"
 #include "SynchronizedHandlers.hpp"
 
@@ -46,8 +48,6 @@ struct ITimeProviderImpl
 
     virtual void OnHandlerAdded() = 0;
 
-    virtual auto Now() const -> std::chrono::nanoseconds = 0;
-
     virtual void SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) = 0;
 };
 
@@ -56,6 +56,9 @@ struct ITimeProviderImplListener
     virtual ~ITimeProviderImplListener() = default;
 
     virtual void OnTick(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) = 0;
+
+    //! Called if a tick handler threw an exception.
+    virtual void OnTickError(const std::string& message) = 0;
 };
 
 class TimeProvider : public ITimeProvider, private ITimeProviderImplListener
@@ -66,7 +69,7 @@ public:
 
 public:
     //ITimeProvider
-    inline auto Now() const -> std::chrono::nanoseconds override;
+    auto Now() const -> std::chrono::nanoseconds override;
     inline auto TimeProviderName() const -> const std::string& override;
     inline HandlerId AddNextSimStepHandler(NextSimStepHandler handler) override;
     inline void RemoveNextSimStepHandler(HandlerId handlerId) override;
@@ -76,14 +79,24 @@ public:
 
     void ConfigureTimeProvider(Orchestration::TimeProviderKind timeProviderKind) override;
 
+    //! The time provider is created before the participant's logger, which is set afterwards.
+    void SetLogger(Logging::ILogger* logger);
+
 private:
     void OnTick(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) final;
+    void OnTickError(const std::string& message) final;
 
 private: //Members
     mutable std::recursive_mutex _mutex;
     Util::Handlers<NextSimStepHandler> _handlers;
     bool _isSynchronizingVirtualTime{false};
     std::unique_ptr<ITimeProviderImpl> _currentProvider;
+
+    // Now() does not take the mutex. The kind of the current provider and the virtual time are published separately.
+    std::atomic<TimeProviderKind> _currentProviderKind{TimeProviderKind::NoSync};
+    std::atomic<std::chrono::nanoseconds::rep> _virtualNow;
+
+    std::atomic<Logging::ILogger*> _logger{nullptr};
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -91,12 +104,6 @@ private: //Members
 /////////////////////////////////////////////////////////////////////
 
 
-auto TimeProvider::Now() const -> std::chrono::nanoseconds
-{
-    std::unique_lock<decltype(_mutex)> lock{_mutex};
-    return _currentProvider->Now();
-}
-
 auto TimeProvider::TimeProviderName() const -> const std::string&
 {
     std::unique_lock<decltype(_mutex)> lock{_mutex};
@@ -120,6 +127,7 @@ void TimeProvider::RemoveNextSimStepHandler(HandlerId handlerId)
 void TimeProvider::SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
 {
     std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _virtualNow.store(now.count(), std::memory_order_release);
     _currentProvider->SetTime(now, duration);
 }
 
@@ -244,7 +244,7 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _timeConfiguration{participant->GetLogger()}
-    , _watchDog{healthCheckConfig}
+    , _watchDog{healthCheckConfig, nullptr, participant->GetLogger()}
 {
     _watchDog.SetWarnHandler([logger = _logger](std::chrono::milliseconds timeout) {
         Warn(logger, "SimStep did not finish within soft time limit. Timeout detected after {} ms",
@@ -19,10 +19,10 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-#include <iostream>
+#include <utility>
 
 #include "WatchDog.hpp"
-#include "SetThreadName.hpp"
+#include "ILogger.hpp"
 
 using namespace std::chrono_literals;
 
@@ -36,10 +36,11 @@ namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
-WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
+WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock, Services::Logging::ILogger* logger)
     : _clock{clock ? clock : GetDefaultClock()}
     , _warnHandler{[](std::chrono::milliseconds) {}}
     , _errorHandler{[](std::chrono::milliseconds) {}}
+    , _logger{logger}
 {
     if (healthCheckConfig.softResponseTimeout.has_value())
     {
@@ -54,22 +55,45 @@ WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
         if (_errorTimeout <= 0ms)
             throw SilKitError{"WatchDog requires errorTimeout > 0ms"};
     }
-    _watchThread = std::thread{&WatchDog::Run, this};
+
+    if (_warnTimeout != _defaultTimeout || _errorTimeout != _defaultTimeout)
+    {
+        _timerService = Util::TimerService::Get();
+    }
 }
 
 WatchDog::~WatchDog()
 {
-    _stopPromise.set_value();
-    _watchThread.join();
+    CancelChecks();
 }
 
 void WatchDog::Start()
 {
+    // Without a timeout, there is nothing to check and the start time is never needed
+    if (_timerService == nullptr)
+    {
+        return;
+    }
+
+    CancelChecks();
+
+    _state = WatchDogState::Healthy;
     _startTime.store(_clock->Now());
+
+    // A warning is only issued if it comes before the error
+    if (_warnTimeout != _defaultTimeout && _warnTimeout < _errorTimeout)
+    {
+        _warnTimerId = ScheduleCheck(_warnTimeout, WatchDogState::Warn);
+    }
+    if (_errorTimeout != _defaultTimeout)
+    {
+        _errorTimerId = ScheduleCheck(_errorTimeout, WatchDogState::Error);
+    }
 }
 
 void WatchDog::Reset()
 {
+    CancelChecks();
     _startTime.store(std::chrono::nanoseconds::min());
 }
 
@@ -83,68 +107,45 @@ void WatchDog::SetErrorHandler(std::function<void(std::chrono::milliseconds)> ha
     _errorHandler = std::move(handler);
 }
 
-void WatchDog::Run()
+auto WatchDog::ScheduleCheck(std::chrono::milliseconds timeout, WatchDogState state) -> Util::TimerService::TimerId
 {
-    enum class WatchDogState
-    {
-        Healthy,
-        Warn,
-        Error
-    };
-
-    SilKit::Util::SetThreadName("SilKit-Watchdog");
-    WatchDogState state = WatchDogState::Healthy;
-    auto stopFuture = _stopPromise.get_future();
+    return _timerService->ScheduleOnce(
+        timeout, [this, state] { Check(state); },
+        [logger = _logger](const std::string& message) { Services::Logging::Error(logger, "WatchDog: {}", message); });
+}
 
-    while (true)
+void WatchDog::CancelChecks()
+{
+    // Waits for a check which is currently executed, so none is running after a step has finished
+    for (auto* timerId : {&_warnTimerId, &_errorTimerId})
     {
-        auto futureStatus = stopFuture.wait_for(_resolution);
-
-        if (futureStatus == std::future_status::ready)
-        {
-            // stop was signaled; stopping thread;
-            return;
-        }
-
-        const auto startTime = _startTime.load();
-
-        // We only communicate with the "main thread" via the atomic _startTime.
-        // If _startTime is duration::min(), Start() has not yet been called.
-        // Otherwise, _startTime is the duration since epoch when the Start() was called.
-        if (startTime == std::chrono::nanoseconds::min())
+        if (*timerId != Util::TimerService::InvalidTimerId)
         {
-            // no job is currently running. Reset state and continue.
-            state = WatchDogState::Healthy;
-            continue;
+            _timerService->Cancel(*timerId);
+            *timerId = Util::TimerService::InvalidTimerId;
         }
+    }
+}
 
-        // These declarations are after the startTime check to prevent integer overflow
-        // by deferring arithmetic on duration::min() until Start() was called.
-        const auto now = _clock->Now();
-        const auto currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
-
-        if (currentRunDuration > _warnTimeout && currentRunDuration <= _errorTimeout)
-        {
-            if (state == WatchDogState::Healthy)
-            {
-                _warnHandler(currentRunDuration);
-                state = WatchDogState::Warn;
-            }
-            continue;
-        }
+void WatchDog::Check(WatchDogState state)
+{
+    // The checks are cancelled before Reset() clears the start time, so it is always set here
+    const auto startTime = _startTime.load();
+    const auto currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(_clock->Now() - startTime);
 
-        if (currentRunDuration > _errorTimeout)
+    if (state == WatchDogState::Warn)
+    {
+        auto expected = WatchDogState::Healthy;
+        if (_state.compare_exchange_strong(expected, WatchDogState::Warn))
         {
-            if (state != WatchDogState::Error)
-            {
-                _errorHandler(currentRunDuration);
-                state = WatchDogState::Error;
-            }
-            continue;
+            _warnHandler(currentRunDuration);
         }
+        return;
+    }
 
-        // If neither warning, nor error timeouts were hit, the state is healthy.
-        state = WatchDogState::Healthy;
+    if (_state.exchange(WatchDogState::Error) != WatchDogState::Error)
+    {
+        _errorHandler(currentRunDuration);
     }
 }
 
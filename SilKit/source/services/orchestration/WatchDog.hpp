@@ -22,11 +22,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <atomic>
-#include <future>
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include "ParticipantConfiguration.hpp"
+#include "TimerService.hpp"
+#include "silkit/services/logging/fwd_decl.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -46,7 +48,8 @@ public:
 public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
-    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr);
+    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr,
+             Services::Logging::ILogger* logger = nullptr);
     ~WatchDog();
 
 public:
@@ -62,10 +65,22 @@ public:
     std::chrono::milliseconds GetWarnTimeout();
     std::chrono::milliseconds GetErrorTimeout();
 
+private:
+    // ----------------------------------------
+    // private data types
+    enum class WatchDogState
+    {
+        Healthy,
+        Warn,
+        Error
+    };
+
 private:
     // ----------------------------------------
     // private methods
-    void Run();
+    auto ScheduleCheck(std::chrono::milliseconds timeout, WatchDogState state) -> Util::TimerService::TimerId;
+    void CancelChecks();
+    void Check(WatchDogState state);
 
 public:
     const std::chrono::milliseconds _defaultTimeout = std::chrono::milliseconds::max();
@@ -73,20 +88,24 @@ public:
 private:
     // ----------------------------------------
     // private members
-    std::promise<void> _stopPromise;
     /// Clock used for watchdog timing. Can be injected via the constructor.
     IClock* _clock;
     // we use a duration instead of a timepoint to avoid a bug in clang6 (up to v9.0)
     std::atomic<std::chrono::nanoseconds> _startTime{std::chrono::nanoseconds::min()};
 
-    std::chrono::milliseconds _resolution = std::chrono::milliseconds{2};
     std::chrono::milliseconds _warnTimeout = _defaultTimeout;
     std::chrono::milliseconds _errorTimeout = _defaultTimeout;
 
     std::function<void(std::chrono::milliseconds)> _warnHandler;
     std::function<void(std::chrono::milliseconds)> _errorHandler;
 
-    std::thread _watchThread;
+    /// Only set if a timeout is configured. Start() schedules a one-shot check at each configured timeout on the shared
+    /// timer service, Reset() cancels them. The clock is not read between the steps, nor while a step is running.
+    std::shared_ptr<Util::TimerService> _timerService;
+    Util::TimerService::TimerId _warnTimerId{Util::TimerService::InvalidTimerId};
+    Util::TimerService::TimerId _errorTimerId{Util::TimerService::InvalidTimerId};
+    Services::Logging::ILogger* _logger;
+    std::atomic<WatchDogState> _state{WatchDogState::Healthy};
 };
 
 } // namespace Orchestration
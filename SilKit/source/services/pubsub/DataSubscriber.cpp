@@ -21,7 +21,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriber.hpp"
 #include "IServiceDiscovery.hpp"
-#include "YamlParser.hpp"
 #include "LabelMatching.hpp"
 
 #include "silkit/services/logging/ILogger.hpp"
@@ -47,8 +46,9 @@ DataSubscriber::DataSubscriber(Core::IParticipantInternal* participant, Config::
 void DataSubscriber::RegisterServiceDiscovery()
 {
     auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
-        auto getVal = [serviceDescriptor](const std::string& key) {
+                               const SilKit::Core::ServiceDescriptor& serviceDescriptor,
+                               const std::vector<SilKit::Services::MatchingLabel>& publisherLabels) {
+        auto getVal = [&serviceDescriptor](const std::string& key) {
             std::string tmp;
             if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
             {
@@ -61,7 +61,7 @@ void DataSubscriber::RegisterServiceDiscovery()
 
         // Early abort creation if Publisher is already connected
         if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated
-            && _internalSubscribers.count(pubUUID) > 0)
+            && _connectedPublishers.count(pubUUID) > 0)
         {
             return;
         }
@@ -72,9 +72,6 @@ void DataSubscriber::RegisterServiceDiscovery()
             const std::string pubMediaType{getVal(Core::Discovery::supplKeyDataPublisherMediaType)};
             if (MatchMediaType(_mediaType, pubMediaType))
             {
-                const std::string labelsStr = getVal(Core::Discovery::supplKeyDataPublisherPubLabels);
-                const std::vector<SilKit::Services::MatchingLabel> publisherLabels =
-                    SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
                 if (Util::MatchLabels(_labels, publisherLabels))
                 {
                     std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
@@ -102,29 +99,41 @@ void DataSubscriber::SetDataMessageHandler(DataMessageHandler callback)
     std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
     auto tracingCallback = WrapTracingCallback(std::move(callback));
     _defaultDataHandler = tracingCallback;
-    for (auto internalSubscriber : _internalSubscribers)
+    if (_internalSubscriber != nullptr)
     {
-        internalSubscriber.second->SetDataMessageHandler(tracingCallback);
+        _internalSubscriber->SetDataMessageHandler(tracingCallback);
     }
 }
 
 void DataSubscriber::AddInternalSubscriber(const std::string& pubUUID, const std::string& joinedMediaType,
                                            const std::vector<SilKit::Services::MatchingLabel>& publisherLabels)
 {
-    auto internalSubscriber = dynamic_cast<DataSubscriberInternal*>(_participant->CreateDataSubscriberInternal(
-        _topic, pubUUID, joinedMediaType, publisherLabels, _defaultDataHandler, this));
-    
-    _internalSubscribers.emplace(pubUUID, internalSubscriber);
+    // A single internal subscriber receives the data of all matching publishers on its own receive link. It is
+    // created (and announced) for the first publisher, with the media type and labels of that publisher, and stays
+    // registered, the publishers' links are only forwarded to it.
+    if (_internalSubscriber == nullptr)
+    {
+        const auto receiveLinkName = _serviceDescriptor.GetParticipantName() + "/" + _topic + "/"
+                                     + std::to_string(_serviceDescriptor.GetServiceId());
+        _internalSubscriber = dynamic_cast<DataSubscriberInternal*>(_participant->CreateDataSubscriberInternal(
+            _topic, receiveLinkName, joinedMediaType, publisherLabels, _defaultDataHandler, this));
+    }
+
+    if (_connectedPublishers.insert(pubUUID).second)
+    {
+        _participant->AddDataSubscriberInternalLink(_internalSubscriber, pubUUID);
+    }
 }
 
 void DataSubscriber::RemoveInternalSubscriber(const std::string& pubUUID)
 {
-    auto internalSubscriber = _internalSubscribers.find(pubUUID);
-    if (internalSubscriber != _internalSubscribers.end())
+    if (_connectedPublishers.erase(pubUUID) == 0)
     {
-        _participant->GetServiceDiscovery()->NotifyServiceRemoved(internalSubscriber->second->GetServiceDescriptor());
-        _internalSubscribers.erase(pubUUID);
+        return;
     }
+
+    // the publisher is gone, its data must not be delivered to the internal subscriber anymore
+    _participant->RemoveDataSubscriberInternalLink(_internalSubscriber, pubUUID);
 }
 
  auto DataSubscriber::WrapTracingCallback(DataMessageHandler callback) ->
@@ -88,7 +88,12 @@ private: //members
 
     Core::ServiceDescriptor _serviceDescriptor{};
 
-    std::unordered_map<std::string, DataSubscriberInternal*> _internalSubscribers;
+    //! Receives the data of all matching publishers, created when the first publisher matches. Its service descriptor
+    //! keeps the media type and labels of that first publisher, even if the publisher is gone or later publishers
+    //! differ. Matching is done by the DataSubscriber itself, so this only affects what is announced.
+    DataSubscriberInternal* _internalSubscriber{nullptr};
+    //! UUIDs of the currently matching publishers, their links are forwarded to the internal subscriber
+    std::unordered_set<std::string> _connectedPublishers;
 
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
@@ -53,6 +53,12 @@ public:
                  (const std::vector<SilKit::Services::MatchingLabel>&)/*publisherLabels*/,
                  Services::PubSub::DataMessageHandler /*callback*/, Services::PubSub::IDataSubscriber* /*parent*/),
                 (override));
+    MOCK_METHOD(void, AddDataSubscriberInternalLink,
+                (Services::PubSub::DataSubscriberInternal* /*internalSubscriber*/, const std::string& /*linkName*/),
+                (override));
+    MOCK_METHOD(void, RemoveDataSubscriberInternalLink,
+                (Services::PubSub::DataSubscriberInternal* /*internalSubscriber*/, const std::string& /*linkName*/),
+                (override));
 };
 
 class Test_DataSubscriber : public ::testing::Test
@@ -77,6 +83,25 @@ protected:
         SetupPublisherServiceDescriptor(publisher, publisherUuid);
     }
 
+    // A publisher sends on its own link, named after its UUID
+    auto MakePublisherDescriptor(const std::string& uuid, EndpointId serviceId) const -> ServiceDescriptor
+    {
+        ServiceDescriptor descriptor{publisherDescriptor};
+        descriptor.SetNetworkName(uuid);
+        descriptor.SetServiceId(serviceId);
+        descriptor.SetSupplementalDataItem(Core::Discovery::supplKeyDataPublisherPubUUID, uuid);
+        return descriptor;
+    }
+
+    auto RegisterDiscoveryHandler() -> Core::Discovery::SpecificServiceDiscoveryHandler
+    {
+        Core::Discovery::SpecificServiceDiscoveryHandler discoveryHandler;
+        EXPECT_CALL(participant.mockServiceDiscovery, RegisterSpecificServiceDiscoveryHandler(_, _, topic, _))
+            .WillOnce(SaveArg<0>(&discoveryHandler));
+        subscriber.RegisterServiceDiscovery();
+        return discoveryHandler;
+    }
+
 private:
     void SetupPublisherServiceDescriptor(DataPublisher& dataPublisher, const std::string& uuid)
     {
@@ -124,4 +149,51 @@ struct CreateSubscriberInternalMock
     }
 };
 
+TEST_F(Test_DataSubscriber, publishers_on_different_links_share_one_internal_subscriber)
+{
+    using Type = Core::Discovery::ServiceDiscoveryEvent::Type;
+
+    const auto discoveryHandler = RegisterDiscoveryHandler();
+
+    CreateSubscriberInternalMock createSubscriberInternal{&participant, nullptr};
+    EXPECT_CALL(participant, CreateDataSubscriberInternal(topic, "P1/Topic/5", _, _, _, &subscriber))
+        .WillOnce(Invoke(&createSubscriberInternal, &CreateSubscriberInternalMock::operator()));
+    EXPECT_CALL(participant, AddDataSubscriberInternalLink(_, publisherUuid)).Times(1);
+    EXPECT_CALL(participant, AddDataSubscriberInternalLink(_, publisher2Uuid)).Times(1);
+    EXPECT_CALL(participant.mockServiceDiscovery, NotifyServiceCreated(_)).Times(0);
+
+    discoveryHandler(Type::ServiceCreated, MakePublisherDescriptor(publisherUuid, 7), labels);
+    discoveryHandler(Type::ServiceCreated, MakePublisherDescriptor(publisher2Uuid, 8), labels);
+    // a publisher which is announced again is already connected
+    discoveryHandler(Type::ServiceCreated, MakePublisherDescriptor(publisherUuid, 7), labels);
+}
+
+TEST_F(Test_DataSubscriber, removed_publisher_releases_its_link_without_reannouncing_the_internal_subscriber)
+{
+    using Type = Core::Discovery::ServiceDiscoveryEvent::Type;
+
+    const auto discoveryHandler = RegisterDiscoveryHandler();
+
+    CreateSubscriberInternalMock createSubscriberInternal{&participant, nullptr};
+    EXPECT_CALL(participant, CreateDataSubscriberInternal(_, _, _, _, _, _))
+        .WillOnce(Invoke(&createSubscriberInternal, &CreateSubscriberInternalMock::operator()));
+    EXPECT_CALL(participant.mockServiceDiscovery, NotifyServiceCreated(_)).Times(0);
+    EXPECT_CALL(participant.mockServiceDiscovery, NotifyServiceRemoved(_)).Times(0);
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(participant, AddDataSubscriberInternalLink(_, publisherUuid)).Times(1);
+        EXPECT_CALL(participant, RemoveDataSubscriberInternalLink(_, publisherUuid)).Times(1);
+        EXPECT_CALL(participant, AddDataSubscriberInternalLink(_, publisher2Uuid)).Times(1);
+    }
+
+    discoveryHandler(Type::ServiceCreated, MakePublisherDescriptor(publisherUuid, 7), labels);
+    discoveryHandler(Type::ServiceRemoved, MakePublisherDescriptor(publisherUuid, 7), labels);
+    // removing an unknown publisher does nothing
+    discoveryHandler(Type::ServiceRemoved, MakePublisherDescriptor(publisherUuid, 7), labels);
+
+    // the internal subscriber is reused for a publisher which matches after all earlier ones are gone
+    discoveryHandler(Type::ServiceCreated, MakePublisherDescriptor(publisher2Uuid, 8), labels);
+}
+
 } // anonymous namespace
@@ -69,8 +69,9 @@ RpcClient::~RpcClient()
 void RpcClient::RegisterServiceDiscovery()
 {
     auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
-        auto getVal = [serviceDescriptor](const std::string& key) {
+                               const SilKit::Core::ServiceDescriptor& serviceDescriptor,
+                               const std::vector<SilKit::Services::MatchingLabel>& /*labels*/) {
+        auto getVal = [&serviceDescriptor](const std::string& key) {
             std::string tmp;
             if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
             {
@@ -112,44 +113,44 @@ void RpcClient::CallWithTimeout(Util::Span<const uint8_t> data, std::chrono::nan
 
 void RpcClient::TimeHandler(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
 {
-    std::vector<TimeoutEntry> timeoutedEntries;
+    std::vector<Util::Uuid> timeoutedCalls;
 
     {
         std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
 
-        for (auto it = _timeoutEntries.begin(); it != _timeoutEntries.end();)
+        _timeoutClock += duration;
+        while (!_timeoutEntries.empty() && _timeoutEntries.top().deadline <= _timeoutClock)
         {
-            it->timeLeft -= duration;
-            if (it->timeLeft <= static_cast<std::chrono::nanoseconds>(0))
-            {
-                timeoutedEntries.insert(timeoutedEntries.end(), std::make_move_iterator(it),
-                                        std::make_move_iterator(it + 1));
-                it = _timeoutEntries.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            timeoutedCalls.push_back(_timeoutEntries.top().callUuid);
+            _timeoutEntries.pop();
         }
     }
 
-    for (auto&& entry : timeoutedEntries)
+    if (timeoutedCalls.empty())
     {
-        auto uuid = entry.callUuid;
+        return;
+    }
 
+    // Calls which already received all their returns are no longer active
+    std::vector<void*> timeoutedUserContexts;
+    {
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        auto it = _activeCalls.find(uuid);
-        auto userContext = it->second.GetUserContext();
 
-        if (it != _activeCalls.end())
+        for (auto&& uuid : timeoutedCalls)
         {
-            _activeCalls.erase(it);
-            lock.unlock();
-
-            _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
+            auto it = _activeCalls.find(uuid);
+            if (it != _activeCalls.end())
+            {
+                timeoutedUserContexts.push_back(it->second.GetUserContext());
+                _activeCalls.erase(it);
+            }
         }
     }
-    timeoutedEntries.clear();
+
+    for (auto&& userContext : timeoutedUserContexts)
+    {
+        _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
+    }
 }
 
 
@@ -167,7 +168,7 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
     {
         const auto callUuid = Util::Uuid::GenerateRandom();
 
-        FunctionCall msg{_timeProvider->Now(), callUuid, Util::ToStdVector(data)};
+        FunctionCall msg{_timeProvider->Now(), callUuid, data};
 
         {
             {
@@ -179,7 +180,7 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
             {
                 {
                     std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
-                    _timeoutEntries.push_back({timeout, callUuid});
+                    _timeoutEntries.push({_timeoutClock + timeout, callUuid});
                 }
 
                 if (!_isTimeoutHandlerSet)
@@ -226,7 +227,7 @@ void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
     if (_handler)
     {
         _handler(this,
-                 RpcCallResultEvent{msg.timestamp, it->second.GetUserContext(), ToRpcCallStatus(msg.status), msg.data});
+                 RpcCallResultEvent{msg.timestamp, it->second.GetUserContext(), ToRpcCallStatus(msg.status), msg.data.AsSpan()});
     }
 
     // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <vector>
+#include <functional>
 #include <future>
 #include <queue>
 #include <set>
@@ -114,12 +115,19 @@ private:
 
     struct TimeoutEntry
     {
-        std::chrono::nanoseconds timeLeft;
+        std::chrono::nanoseconds deadline;
         Util::Uuid callUuid;
-    };
 
+        friend bool operator>(const TimeoutEntry& lhs, const TimeoutEntry& rhs)
+        {
+            return lhs.deadline > rhs.deadline;
+        }
+    };
 
-    std::vector<TimeoutEntry> _timeoutEntries{};
+    //! Sum of the step durations since the first call with timeout. The deadlines of the entries are relative to it.
+    std::chrono::nanoseconds _timeoutClock{0};
+    //! Min-heap of the timeout entries, ordered by their deadline
+    std::priority_queue<TimeoutEntry, std::vector<TimeoutEntry>, std::greater<TimeoutEntry>> _timeoutEntries{};
     std::function<void(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)> _timeoutHandler{};
     Services::HandlerId _timeoutHandlerId{};
     std::atomic<bool> _isTimeoutHandlerSet{ false };
@@ -72,11 +72,33 @@ struct MockConnection
         services.rpcServerInternal.push_back(receiver);
     }
 
+    template <class SilKitServiceT>
+    void RegisterSilKitServiceOnNetwork(SilKitServiceT* /*service*/, const std::string& /*networkName*/)
+    {
+    }
+
+    template <class SilKitServiceT>
+    void UnregisterSilKitServiceFromNetwork(SilKitServiceT* /*service*/, const std::string& /*networkName*/)
+    {
+    }
+
     template <class SilKitServiceT>
     void SetHistoryLengthForLink(size_t /*history*/, SilKitServiceT* /*service*/)
     {
     }
 
+    template <class SilKitMessageT>
+    void AddRemoteServiceToLink(const std::string& /*networkName*/,
+                                const SilKit::Core::ServiceDescriptor& /*serviceDescriptor*/)
+    {
+    }
+
+    template <class SilKitMessageT>
+    void RemoveRemoteServiceFromLink(const std::string& /*networkName*/,
+                                     const SilKit::Core::ServiceDescriptor& /*serviceDescriptor*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const SilKit::Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/)
     {
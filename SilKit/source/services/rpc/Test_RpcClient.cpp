@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -39,8 +40,47 @@ namespace {
 using namespace SilKit::Services::Rpc;
 using namespace SilKit::Services::Rpc::Tests;
 
+using namespace std::chrono_literals;
+
 class Test_RpcClient : public RpcTestBase
 {
+protected:
+    void TearDown() override
+    {
+        // Destroy the services while the time provider they might have registered a step handler on is still alive
+        participant.reset();
+    }
+
+    // Makes the server keep the calls open, so they only complete when SubmitPendingResult is called
+    void CreateRpcServerWithPendingCalls()
+    {
+        IRpcServer* iRpcServer = CreateRpcServer();
+        iRpcServer->SetCallHandler([this](IRpcServer* /*rpcServer*/, RpcCallEvent event) {
+            pendingCallHandles.push_back(event.callHandle);
+        });
+    }
+
+    void SubmitPendingResult(size_t index)
+    {
+        CreateRpcServer()->SubmitResult(pendingCallHandles.at(index), sampleData);
+    }
+
+    void Step(std::chrono::nanoseconds duration)
+    {
+        steppedTimeProvider.now += duration;
+        steppedTimeProvider._handlers.InvokeAll(steppedTimeProvider.now, duration);
+    }
+
+    static auto UserContext(uintptr_t value) -> void* { return reinterpret_cast<void*>(value); }
+
+    static auto IsResult(void* userContext, RpcCallStatus callStatus) -> testing::Matcher<RpcCallResultEvent>
+    {
+        return testing::AllOf(testing::Field(&RpcCallResultEvent::userContext, userContext),
+                              testing::Field(&RpcCallResultEvent::callStatus, callStatus));
+    }
+
+    SilKit::Core::Tests::MockTimeProvider steppedTimeProvider;
+    std::vector<IRpcCallHandle*> pendingCallHandles;
 };
 
 TEST_F(Test_RpcClient, rpc_client_calls_result_handler_with_error_when_no_server_available)
@@ -88,7 +128,7 @@ TEST_F(Test_RpcClient, rpc_client_call_sends_message_with_current_timestamp_and_
     EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
         .WillOnce([this, &fixedTimeProvider](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCall& msg) {
             ASSERT_EQ(msg.timestamp, fixedTimeProvider.now);
-            ASSERT_EQ(msg.data, sampleData);
+            ASSERT_EQ(SilKit::Util::ToStdVector(msg.data.AsSpan()), sampleData);
         });
 
     // HACK: Change the time provider for the captured services. Must happen _after_ the RpcServer and RpcClient (and
@@ -125,4 +165,75 @@ TEST_F(Test_RpcClient, rpc_client_call_receives_internal_server_error_when_serve
     iRpcClient->Call(sampleData, userContext);
 }
 
+TEST_F(Test_RpcClient, rpc_client_call_timeouts_expire_in_deadline_order)
+{
+    CreateRpcServerWithPendingCalls();
+    IRpcClient* iRpcClient = CreateRpcClient();
+    iRpcClient->SetCallResultHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::CallResultHandler));
+    participant->GetSilKitConnection().Test_SetTimeProvider(&steppedTimeProvider);
+
+    iRpcClient->CallWithTimeout(sampleData, 30ms, UserContext(3));
+    iRpcClient->CallWithTimeout(sampleData, 10ms, UserContext(1));
+    iRpcClient->CallWithTimeout(sampleData, 20ms, UserContext(2));
+    ASSERT_EQ(pendingCallHandles.size(), 3u);
+
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, IsResult(UserContext(1), RpcCallStatus::Timeout)))
+            .Times(1);
+        EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, IsResult(UserContext(2), RpcCallStatus::Timeout)))
+            .Times(1);
+        EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, IsResult(UserContext(3), RpcCallStatus::Timeout)))
+            .Times(1);
+    }
+
+    Step(5ms);
+    Step(5ms);
+    // The remaining two deadlines expire within a single step
+    Step(25ms);
+}
+
+TEST_F(Test_RpcClient, rpc_client_call_completed_before_its_deadline_does_not_time_out)
+{
+    CreateRpcServerWithPendingCalls();
+    IRpcClient* iRpcClient = CreateRpcClient();
+    iRpcClient->SetCallResultHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::CallResultHandler));
+    participant->GetSilKitConnection().Test_SetTimeProvider(&steppedTimeProvider);
+
+    iRpcClient->CallWithTimeout(sampleData, 10ms, UserContext(1));
+    iRpcClient->CallWithTimeout(sampleData, 20ms, UserContext(2));
+    ASSERT_EQ(pendingCallHandles.size(), 2u);
+
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, IsResult(UserContext(1), RpcCallStatus::Success)))
+            .Times(1);
+        EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, IsResult(UserContext(2), RpcCallStatus::Timeout)))
+            .Times(1);
+    }
+
+    SubmitPendingResult(0);
+    Step(30ms);
+}
+
+TEST_F(Test_RpcClient, rpc_client_ignores_results_and_timeouts_of_finished_calls)
+{
+    CreateRpcServerWithPendingCalls();
+    IRpcClient* iRpcClient = CreateRpcClient();
+    iRpcClient->SetCallResultHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::CallResultHandler));
+    participant->GetSilKitConnection().Test_SetTimeProvider(&steppedTimeProvider);
+
+    iRpcClient->CallWithTimeout(sampleData, 10ms, UserContext(1));
+    ASSERT_EQ(pendingCallHandles.size(), 1u);
+
+    EXPECT_CALL(callbacks, CallResultHandler(iRpcClient, IsResult(UserContext(1), RpcCallStatus::Timeout)))
+        .Times(1);
+
+    Step(10ms);
+
+    // The call is unknown to the client after its timeout, neither its late result nor later steps report it again
+    SubmitPendingResult(0);
+    Step(10ms);
+}
+
 } // anonymous namespace
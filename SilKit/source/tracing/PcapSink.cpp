@@ -21,12 +21,15 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "PcapSink.hpp"
 
+#include <algorithm>
 #include <string>
 #include <ctime>
+#include <cstring>
 #include <sstream>
 
 #include "TraceMessage.hpp"
 #include "string_utils.hpp"
+#include "SetThreadName.hpp"
 
 #include "Pcap.hpp"
 #include "detail/NamedPipe.hpp"
@@ -40,12 +43,39 @@ using namespace SilKit::Services::Logging;
 
 namespace {
 constexpr Pcap::GlobalHeader g_pcapGlobalHeader{};
+// records are queued in chunks of this size, the writer thread is woken up for each full chunk, or when it is idle
+constexpr size_t g_writeBatchSize{256 * 1024};
+
+auto MakePacketHeader(std::chrono::nanoseconds timestamp, size_t frameSize) -> Pcap::PacketHeader
+{
+    const auto tosec = 1000'000ull;
+    const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(timestamp);
+
+    Pcap::PacketHeader pcapPacketHeader;
+    pcapPacketHeader.orig_len = static_cast<uint32_t>(frameSize);
+    pcapPacketHeader.incl_len = pcapPacketHeader.orig_len;
+    pcapPacketHeader.ts_sec = static_cast<uint32_t>(usec.count() / tosec);
+    pcapPacketHeader.ts_usec = static_cast<uint32_t>(usec.count() % tosec);
+    return pcapPacketHeader;
+}
 } // namespace
 
 PcapSink::PcapSink(Services::Logging::ILogger* logger, std::string name)
+    : PcapSink{logger, std::move(name), false}
+{
+}
+
+PcapSink::PcapSink(Services::Logging::ILogger* logger, std::string name, bool asynchronous, size_t maxQueuedBytes)
     : _name{std::move(name)}
     , _logger{logger}
+    , _asynchronous{asynchronous}
+    , _maxQueuedBytes{maxQueuedBytes}
+{
+}
+
+PcapSink::~PcapSink()
 {
+    StopWriterThread();
 }
 
 void PcapSink::Open(SinkType outputType, const std::string& outputPath)
@@ -73,6 +103,11 @@ void PcapSink::Open(SinkType outputType, const std::string& outputPath)
         break;
     default: throw SilKitError("PcapSink::Open: specified SinkType not implemented");
     }
+
+    if (_asynchronous)
+    {
+        StartWriterThread();
+    }
 }
 
 auto PcapSink::GetLogger() const -> Services::Logging::ILogger*
@@ -85,8 +120,32 @@ auto PcapSink::Name() const -> const std::string&
     return _name;
 }
 
+auto PcapSink::IsAsynchronous() const -> bool
+{
+    return _asynchronous;
+}
+
+auto PcapSink::GetStatistics() const -> PcapSinkStatistics
+{
+    PcapSinkStatistics statistics;
+    statistics.framesWritten = _framesWritten;
+    statistics.framesDropped = _framesDropped;
+    statistics.bytesWritten = _bytesWritten;
+    statistics.batchesWritten = _batchesWritten;
+    return statistics;
+}
+
 void PcapSink::Close()
 {
+    // write all queued frames before closing the output
+    StopWriterThread();
+
+    if (_asynchronous && _framesDropped > 0)
+    {
+        Services::Logging::Warn(_logger, "Sink {}: dropped {} of {} traced frames", _name, _framesDropped.load(),
+                                _framesWritten + _framesDropped);
+    }
+
     if (_file)
     {
         _file.flush();
@@ -118,17 +177,51 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
         throw SilKitError(ss.str());
     }
     const auto& message = traceMessage.Get<Services::Ethernet::EthernetFrame>();
+    const auto pcapPacketHeader = MakePacketHeader(timestamp, message.raw.size());
 
-    std::unique_lock<decltype(_lock)> lock;
+    if (_asynchronous)
+    {
+        const auto recordSize = sizeof(pcapPacketHeader) + message.raw.size();
 
-    const auto tosec = 1000'000ull;
-    const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(timestamp);
+        bool wakeWriter = false;
+        {
+            std::lock_guard<decltype(_queueMutex)> lock{_queueMutex};
 
-    Pcap::PacketHeader pcapPacketHeader;
-    pcapPacketHeader.orig_len = static_cast<uint32_t>(message.raw.size());
-    pcapPacketHeader.incl_len = pcapPacketHeader.orig_len;
-    pcapPacketHeader.ts_sec = static_cast<uint32_t>(usec.count() / tosec);
-    pcapPacketHeader.ts_usec = static_cast<uint32_t>(usec.count() % tosec);
+            // never block the caller, the writer thread cannot keep up with the traced frames, or it is not running
+            if (_stopWriter || _outputFailed || _queuedBytes + recordSize > _maxQueuedBytes)
+            {
+                ++_framesDropped;
+                return;
+            }
+
+            const auto wasIdle = _queuedChunks.empty();
+            if (wasIdle || _queuedChunks.back().size() + recordSize > _queuedChunks.back().capacity())
+            {
+                // chunks are reused, only a record larger than a chunk requires a bigger allocation
+                _queuedChunks.emplace_back(TakeFreeChunk(recordSize));
+            }
+
+            auto& chunk = _queuedChunks.back();
+            const auto offset = chunk.size();
+            chunk.resize(offset + recordSize);
+            std::memcpy(chunk.data() + offset, &pcapPacketHeader, sizeof(pcapPacketHeader));
+            std::memcpy(chunk.data() + offset + sizeof(pcapPacketHeader), message.raw.data(), message.raw.size());
+
+            _queuedBytes += recordSize;
+            ++_queuedFrames;
+
+            // wake the writer for the first record (it is idle) or when a chunk is full
+            wakeWriter = wasIdle || _queuedChunks.size() == 2;
+        }
+
+        if (wakeWriter)
+        {
+            _queueCondition.notify_one();
+        }
+        return;
+    }
+
+    std::unique_lock<decltype(_lock)> lock{_lock};
 
     bool ok = true;
     if (_file.is_open())
@@ -140,17 +233,7 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
 
     if (_pipe)
     {
-        if (!_headerWritten)
-        {
-            Services::Logging::Info(_logger, "Sink {}: Waiting for a reader to connect to PCAP pipe {} ... ", _name,
-                                    _outputPath);
-
-            ok &= _pipe->Write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
-            Services::Logging::Debug(_logger, "Sink {}: PCAP pipe: {} is connected successfully", _name, _outputPath);
-
-            _headerWritten = true;
-        }
-
+        ok &= WriteGlobalHeaderToPipe();
         ok &= _pipe->Write(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
         ok &= _pipe->Write(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
     }
@@ -161,5 +244,157 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
     }
 }
 
+bool PcapSink::WriteGlobalHeaderToPipe()
+{
+    if (_headerWritten)
+    {
+        return true;
+    }
+
+    Services::Logging::Info(_logger, "Sink {}: Waiting for a reader to connect to PCAP pipe {} ... ", _name,
+                            _outputPath);
+
+    const auto ok = _pipe->Write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
+    Services::Logging::Debug(_logger, "Sink {}: PCAP pipe: {} is connected successfully", _name, _outputPath);
+
+    _headerWritten = true;
+    return ok;
+}
+
+bool PcapSink::WriteToOutput(const char* data, size_t size)
+{
+    bool ok = true;
+    if (_file.is_open())
+    {
+        _file.write(data, size);
+        ok &= _file.good();
+    }
+
+    if (_pipe)
+    {
+        ok &= WriteGlobalHeaderToPipe();
+        ok &= _pipe->Write(data, size);
+    }
+    return ok;
+}
+
+auto PcapSink::TakeFreeChunk(size_t minCapacity) -> std::vector<char>
+{
+    std::vector<char> chunk;
+    if (!_freeChunks.empty())
+    {
+        chunk = std::move(_freeChunks.back());
+        _freeChunks.pop_back();
+    }
+
+    chunk.reserve(std::max(g_writeBatchSize, minCapacity));
+    return chunk;
+}
+
+void PcapSink::StartWriterThread()
+{
+    StopWriterThread();
+
+    std::lock_guard<decltype(_queueMutex)> lock{_queueMutex};
+    _stopWriter = false;
+    _outputFailed = false;
+    _queuedFrames = 0;
+    _queuedBytes = 0;
+    _queuedChunks.clear();
+    _freeChunks.emplace_back();
+    _freeChunks.back().reserve(g_writeBatchSize);
+    _writerThread = std::thread{[this] {
+        SilKit::Util::SetThreadName("SilKitPcapSink");
+        RunWriterThread();
+    }};
+}
+
+void PcapSink::StopWriterThread()
+{
+    if (!_writerThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<decltype(_queueMutex)> lock{_queueMutex};
+        _stopWriter = true;
+    }
+    _queueCondition.notify_one();
+
+    _writerThread.join();
+}
+
+void PcapSink::RunWriterThread()
+{
+    std::unique_lock<decltype(_queueMutex)> lock{_queueMutex};
+
+    while (true)
+    {
+        _queueCondition.wait(lock, [this] {
+            return _stopWriter || !_queuedChunks.empty();
+        });
+
+        if (_queuedChunks.empty())
+        {
+            // stopping and all queued frames have been written
+            return;
+        }
+
+        // take all queued chunks, Trace continues with chunks returned by the previous batch
+        std::swap(_writeChunks, _queuedChunks);
+        const auto framesInBatch = _queuedFrames;
+        const auto bytesInBatch = _queuedBytes;
+        _queuedFrames = 0;
+        _queuedBytes = 0;
+        lock.unlock();
+
+        bool ok = true;
+        try
+        {
+            for (const auto& chunk : _writeChunks)
+            {
+                ok = ok && WriteToOutput(chunk.data(), chunk.size());
+            }
+        }
+        catch (const std::exception& error)
+        {
+            Services::Logging::Error(_logger, "Sink {}: {}", _name, error.what());
+            ok = false;
+        }
+
+        if (ok)
+        {
+            _framesWritten += framesInBatch;
+            _bytesWritten += bytesInBatch;
+            _batchesWritten += _writeChunks.size();
+        }
+        else
+        {
+            _framesDropped += framesInBatch;
+        }
+
+        for (auto& chunk : _writeChunks)
+        {
+            chunk.clear();
+        }
+
+        lock.lock();
+
+        for (auto& chunk : _writeChunks)
+        {
+            _freeChunks.emplace_back(std::move(chunk));
+        }
+        _writeChunks.clear();
+
+        if (!ok && !_outputFailed)
+        {
+            Services::Logging::Error(_logger, "Sink {}: Failed to write trace messages to PCAP sink, dropping all "
+                                              "further frames", _name);
+            _outputFailed = true;
+        }
+    }
+}
+
 } // namespace Tracing
 } // namespace SilKit
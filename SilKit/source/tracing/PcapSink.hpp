@@ -21,9 +21,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <fstream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "ITraceMessageSink.hpp"
 
@@ -33,6 +37,19 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Tracing {
 
+//! Counters of an asynchronous PcapSink
+struct PcapSinkStatistics
+{
+    //! Number of frames written to the output
+    uint64_t framesWritten{0};
+    //! Number of frames dropped because the queue was full or the output failed
+    uint64_t framesDropped{0};
+    //! Number of bytes (headers and frames) written to the output
+    uint64_t bytesWritten{0};
+    //! Number of write batches issued by the writer thread
+    uint64_t batchesWritten{0};
+};
+
 class PcapSink : public ITraceMessageSink
 {
 public:
@@ -41,7 +58,15 @@ public:
     PcapSink() = delete;
     PcapSink(const PcapSink&) = delete;
     PcapSink(Services::Logging::ILogger* logger, std::string name);
-    ~PcapSink() = default;
+    //! In asynchronous mode, Trace only copies the frame into a queue of at most maxQueuedBytes bytes.
+    //! A dedicated writer thread writes the queued frames in large batches. Frames which do not fit into
+    //! the queue, or which are traced while the sink is not open, are dropped and counted, instead of
+    //! blocking the caller.
+    PcapSink(Services::Logging::ILogger* logger, std::string name, bool asynchronous,
+             size_t maxQueuedBytes = DefaultMaxQueuedBytes);
+    ~PcapSink();
+
+    static constexpr size_t DefaultMaxQueuedBytes{64 * 1024 * 1024};
 
     // ----------------------------------------
     // Public methods
@@ -56,6 +81,19 @@ public:
 
     auto Name() const -> const std::string& override;
 
+    auto IsAsynchronous() const -> bool;
+    auto GetStatistics() const -> PcapSinkStatistics;
+
+private:
+    // ----------------------------------------
+    // Private methods
+    bool WriteGlobalHeaderToPipe();
+    bool WriteToOutput(const char* data, size_t size);
+    auto TakeFreeChunk(size_t minCapacity) -> std::vector<char>;
+    void StartWriterThread();
+    void StopWriterThread();
+    void RunWriterThread();
+
 private:
     // ----------------------------------------
     // Private members
@@ -67,6 +105,26 @@ private:
     std::string _busName;
     std::string _outputPath;
     Services::Logging::ILogger* _logger{nullptr};
+
+    // asynchronous mode: Trace appends to the last of the _queuedChunks, the writer thread swaps them with
+    // _writeChunks and returns the written chunks to _freeChunks, so the queue never reallocates under the lock
+    bool _asynchronous{false};
+    size_t _maxQueuedBytes{DefaultMaxQueuedBytes};
+    std::thread _writerThread;
+    std::mutex _queueMutex;
+    std::condition_variable _queueCondition;
+    std::vector<std::vector<char>> _queuedChunks;
+    std::vector<std::vector<char>> _writeChunks;
+    std::vector<std::vector<char>> _freeChunks;
+    size_t _queuedBytes{0};
+    uint64_t _queuedFrames{0};
+    bool _stopWriter{true};
+    bool _outputFailed{false};
+
+    std::atomic<uint64_t> _framesWritten{0};
+    std::atomic<uint64_t> _framesDropped{0};
+    std::atomic<uint64_t> _bytesWritten{0};
+    std::atomic<uint64_t> _batchesWritten{0};
 };
 
 } // namespace Tracing
@@ -20,7 +20,10 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "PcapReader.hpp"
+#include "PcapSink.hpp"
+#include "TraceMessage.hpp"
 
+#include <cstdio>
 #include <cstring>
 
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
@@ -107,4 +110,103 @@ TEST(Test_Pcap, read_from_pcap)
     EXPECT_EQ((int)numMessages, 10);
 }
 
+TEST(Test_Pcap, asynchronous_sink_writes_all_frames_in_order)
+{
+    MockLogger log;
+    const std::string filePath{"Test_Pcap_asynchronous_sink.pcap"};
+
+    WireEthernetFrame wireFrame;
+    MakePcapTestData(wireFrame, 0);
+    const auto frame = ToEthernetFrame(wireFrame);
+    const auto numFrames = 1000u;
+
+    PcapSink sink{&log, "AsyncSink", true};
+    ASSERT_TRUE(sink.IsAsynchronous());
+    sink.Open(SilKit::SinkType::PcapFile, filePath);
+    for (auto i = 0u; i < numFrames; i++)
+    {
+        sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{i}, SilKit::TraceMessage{frame});
+    }
+    sink.Close();
+
+    const auto statistics = sink.GetStatistics();
+    EXPECT_EQ(statistics.framesWritten, numFrames);
+    EXPECT_EQ(statistics.framesDropped, 0u);
+    EXPECT_EQ(statistics.bytesWritten, numFrames * (Pcap::PacketHeaderSize + frame.raw.size()));
+    EXPECT_GE(statistics.batchesWritten, 1u);
+
+    auto numMessages = 0u;
+    {
+        PcapReader reader{filePath, &log};
+        while (auto msg = reader.Read())
+        {
+            EXPECT_EQ(msg->Timestamp(), std::chrono::microseconds{numMessages});
+            auto ethMsg = dynamic_cast<WireEthernetFrame&>(*msg);
+            EXPECT_TRUE(ItemsAreEqual(ethMsg.raw.AsSpan(), wireFrame.raw.AsSpan()));
+            numMessages++;
+
+            if (!reader.Seek(1))
+            {
+                break;
+            }
+        }
+    }
+    EXPECT_EQ(numMessages, numFrames);
+
+    std::remove(filePath.c_str());
+}
+
+TEST(Test_Pcap, asynchronous_sink_drops_frames_exceeding_the_queue)
+{
+    MockLogger log;
+    const std::string filePath{"Test_Pcap_asynchronous_sink_drops.pcap"};
+
+    WireEthernetFrame wireFrame;
+    MakePcapTestData(wireFrame, 0);
+    const auto frame = ToEthernetFrame(wireFrame);
+
+    // the queue cannot hold a single record, every frame is dropped instead of blocking the caller
+    PcapSink sink{&log, "AsyncSink", true, Pcap::PacketHeaderSize};
+    sink.Open(SilKit::SinkType::PcapFile, filePath);
+    for (auto i = 0u; i < 10; i++)
+    {
+        sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{i}, SilKit::TraceMessage{frame});
+    }
+    sink.Close();
+
+    const auto statistics = sink.GetStatistics();
+    EXPECT_EQ(statistics.framesWritten, 0u);
+    EXPECT_EQ(statistics.framesDropped, 10u);
+    EXPECT_EQ(statistics.bytesWritten, 0u);
+
+    std::remove(filePath.c_str());
+}
+
+TEST(Test_Pcap, asynchronous_sink_drops_frames_after_close)
+{
+    MockLogger log;
+    const std::string filePath{"Test_Pcap_asynchronous_sink_closed.pcap"};
+
+    WireEthernetFrame wireFrame;
+    MakePcapTestData(wireFrame, 0);
+    const auto frame = ToEthernetFrame(wireFrame);
+
+    PcapSink sink{&log, "AsyncSink", true};
+    sink.Open(SilKit::SinkType::PcapFile, filePath);
+    sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{0}, SilKit::TraceMessage{frame});
+    sink.Close();
+
+    // the writer thread is stopped, the frames are not queued anymore
+    for (auto i = 1u; i < 10; i++)
+    {
+        sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{i}, SilKit::TraceMessage{frame});
+    }
+
+    const auto statistics = sink.GetStatistics();
+    EXPECT_EQ(statistics.framesWritten, 1u);
+    EXPECT_EQ(statistics.framesDropped, 9u);
+
+    std::remove(filePath.c_str());
+}
+
 } // namespace
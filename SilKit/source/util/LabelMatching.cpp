@@ -20,67 +20,105 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LabelMatching.hpp"
-#include "Optional.hpp"
+
+#include <algorithm>
 
 namespace SilKit {
 namespace Util {
 
 using namespace SilKit::Services;
 
-Optional<MatchingLabel> TryFindLabelByKey(const std::string& key, const std::vector<MatchingLabel>& labels)
+namespace {
+
+// Label lists up to this size are matched by searching linearly, larger ones by a merge of the lists sorted by key
+constexpr size_t LinearMatchingMaxLabels = 8;
+
+bool LabelMatchesFoundLabel(const MatchingLabel& label, const MatchingLabel* foundLabel)
+{
+    if (foundLabel == nullptr) // Key not found
+    {
+        // Mandatory labels must exist, optional labels that do not exist are ignored
+        return label.kind != MatchingLabel::Kind::Mandatory;
+    }
+
+    // Key found and value does not match -> no match
+    return label.value == foundLabel->value;
+}
+
+auto TryFindLabelByKey(const std::string& key, const std::vector<MatchingLabel>& labels) -> const MatchingLabel*
 {
-    for (auto it : labels)
+    for (const auto& label : labels)
     {
-        if (it.key == key)
+        if (label.key == key)
         {
-            return {it};
+            return &label;
         }
     }
-    return Optional<MatchingLabel>();
+    return nullptr;
 }
 
-bool LabelMatchesLabelList(MatchingLabel label, const std::vector<MatchingLabel>& labels)
+bool LabelsMatchLabelList(const std::vector<MatchingLabel>& labels1, const std::vector<MatchingLabel>& labels2)
 {
-    auto foundLabel = TryFindLabelByKey(label.key, labels);
-
-    if (!foundLabel.has_value()) // Key not found
+    for (const auto& label : labels1)
     {
-        if (label.kind == MatchingLabel::Kind::Mandatory)
+        if (!LabelMatchesFoundLabel(label, TryFindLabelByKey(label.key, labels2)))
         {
-            // Mandatory labels must exist
             return false;
         }
-        // Optional labels that do not exist are ignored
     }
-    else if (label.value != foundLabel.value().value) 
+    return true;
+}
+
+auto SortedByKey(const std::vector<MatchingLabel>& labels) -> std::vector<const MatchingLabel*>
+{
+    std::vector<const MatchingLabel*> sorted;
+    sorted.reserve(labels.size());
+    for (const auto& label : labels)
     {
-       // Key found and value does not match -> no match
-       return false;
+        sorted.push_back(&label);
     }
 
-    return true;
+    // stable, so the first label of duplicate keys is found, like in the linear search
+    std::stable_sort(sorted.begin(), sorted.end(), [](const MatchingLabel* lhs, const MatchingLabel* rhs) {
+        return lhs->key < rhs->key;
+    });
+    return sorted;
 }
 
-bool MatchLabels(const std::vector<MatchingLabel>& labels1,
-                 const std::vector<MatchingLabel>& labels2)
+bool SortedLabelsMatchLabelList(const std::vector<const MatchingLabel*>& labels1,
+                                const std::vector<const MatchingLabel*>& labels2)
 {
-    // Check each labels1 against labels2 and bailout on negative match
-    for (auto&& label : labels1)
+    auto it2 = labels2.begin();
+    for (const auto* label : labels1)
     {
-        if (!LabelMatchesLabelList(label, labels2))
+        while (it2 != labels2.end() && (*it2)->key < label->key)
         {
-            return false;
+            ++it2;
         }
-    }
-    // Matching is symmetric: Do the reverse
-    for (auto&& label : labels2)
-    {
-        if (!LabelMatchesLabelList(label, labels1))
+
+        const MatchingLabel* foundLabel = (it2 != labels2.end() && (*it2)->key == label->key) ? *it2 : nullptr;
+        if (!LabelMatchesFoundLabel(*label, foundLabel))
         {
             return false;
         }
     }
-    return true; // All of the labels match according to their rules -> match
+    return true;
+}
+
+} // namespace
+
+bool MatchLabels(const std::vector<MatchingLabel>& labels1,
+                 const std::vector<MatchingLabel>& labels2)
+{
+    // Matching is symmetric: Check each label against the other list in both directions, bailout on negative match
+    if (labels1.size() <= LinearMatchingMaxLabels && labels2.size() <= LinearMatchingMaxLabels)
+    {
+        return LabelsMatchLabelList(labels1, labels2) && LabelsMatchLabelList(labels2, labels1);
+    }
+
+    const auto sorted1 = SortedByKey(labels1);
+    const auto sorted2 = SortedByKey(labels2);
+    return SortedLabelsMatchLabelList(sorted1, sorted2) && SortedLabelsMatchLabelList(sorted2, sorted1);
 }
 
 } // namespace Util
@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "LzCompression.hpp"
+
+#include <array>
+
+#include <cstring>
+
+#include "silkit/participant/exception.hpp"
+
+namespace {
+
+// The block layout follows the LZ4 block format: every sequence starts with a token holding the literal length (high
+// nibble) and the match length minus MinMatch (low nibble), a nibble of 15 is continued by bytes of 255 and a final
+// byte below 255. The literals are followed by a little-endian 16 bit offset and the continuation of the match length.
+// The last sequence consists only of literals.
+
+constexpr size_t MinMatch{4};
+constexpr size_t LastLiterals{5};
+constexpr size_t MaxOffset{65535};
+constexpr size_t HashLog{12};
+constexpr uint8_t LengthMask{15};
+constexpr size_t MaxExpansion{255};
+
+auto Read32(const uint8_t* p) -> uint32_t
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+auto Hash(uint32_t value) -> uint32_t
+{
+    return (value * 2654435761u) >> (32 - HashLog);
+}
+
+void WriteLengthContinuation(std::vector<uint8_t>& output, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        output.push_back(255);
+    }
+    output.push_back(static_cast<uint8_t>(length));
+}
+
+void WriteSequence(std::vector<uint8_t>& output, const uint8_t* literals, size_t literalLength, size_t offset,
+                   size_t matchLength)
+{
+    const bool hasMatch = matchLength != 0;
+    const size_t matchCode = hasMatch ? matchLength - MinMatch : 0;
+
+    const auto literalNibble = static_cast<uint8_t>(literalLength < LengthMask ? literalLength : LengthMask);
+    const auto matchNibble = static_cast<uint8_t>(matchCode < LengthMask ? matchCode : LengthMask);
+    output.push_back(static_cast<uint8_t>((literalNibble << 4) | matchNibble));
+
+    if (literalLength >= LengthMask)
+    {
+        WriteLengthContinuation(output, literalLength - LengthMask);
+    }
+    output.insert(output.end(), literals, literals + literalLength);
+
+    if (!hasMatch)
+    {
+        return;
+    }
+
+    output.push_back(static_cast<uint8_t>(offset & 0xff));
+    output.push_back(static_cast<uint8_t>((offset >> 8) & 0xff));
+
+    if (matchCode >= LengthMask)
+    {
+        WriteLengthContinuation(output, matchCode - LengthMask);
+    }
+}
+
+auto ReadLengthContinuation(SilKit::Util::Span<const uint8_t> input, size_t& pos) -> size_t
+{
+    size_t length{0};
+    uint8_t value{0};
+    do
+    {
+        if (pos >= input.size())
+        {
+            throw SilKit::ProtocolError{"LzDecompress: truncated length"};
+        }
+        value = input[pos++];
+        length += value;
+    } while (value == 255);
+    return length;
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Util {
+
+auto LzCompress(Span<const uint8_t> input) -> std::vector<uint8_t>
+{
+    const auto* const data = input.data();
+    const auto size = input.size();
+
+    std::vector<uint8_t> output;
+    output.reserve(size + size / 255 + 16);
+
+    size_t anchor{0};
+
+    if (size > MinMatch + LastLiterals)
+    {
+        // positions are stored with an offset of one, zero marks an empty slot
+        std::array<uint32_t, size_t{1} << HashLog> table{};
+
+        const size_t matchLimit = size - LastLiterals;
+        size_t pos{0};
+        size_t misses{0};
+
+        while (pos + MinMatch <= matchLimit)
+        {
+            const auto value = Read32(data + pos);
+            auto& slot = table[Hash(value)];
+            const size_t candidate = slot;
+            slot = static_cast<uint32_t>(pos + 1);
+
+            if (candidate == 0 || pos + 1 - candidate > MaxOffset || Read32(data + candidate - 1) != value)
+            {
+                // skip faster through data which does not compress
+                pos += 1 + (misses++ >> 6);
+                continue;
+            }
+
+            const size_t matchPos = candidate - 1;
+            size_t matchLength{MinMatch};
+            while (pos + matchLength < matchLimit && data[matchPos + matchLength] == data[pos + matchLength])
+            {
+                ++matchLength;
+            }
+
+            WriteSequence(output, data + anchor, pos - anchor, pos - matchPos, matchLength);
+
+            pos += matchLength;
+            anchor = pos;
+            misses = 0;
+        }
+    }
+
+    WriteSequence(output, data + anchor, size - anchor, 0, 0);
+    return output;
+}
+
+auto LzDecompress(Span<const uint8_t> input, size_t uncompressedSize) -> std::vector<uint8_t>
+{
+    // a byte of the block produces at most 255 bytes of output (a length continuation of 255), the size is checked
+    // before it is allocated
+    if (uncompressedSize / MaxExpansion > input.size())
+    {
+        throw SilKit::ProtocolError{"LzDecompress: uncompressed size exceeds the maximum expansion of the block"};
+    }
+
+    std::vector<uint8_t> output(uncompressedSize);
+
+    size_t pos{0};
+    size_t outPos{0};
+
+    while (pos < input.size())
+    {
+        const auto token = input[pos++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == LengthMask)
+        {
+            literalLength += ReadLengthContinuation(input, pos);
+        }
+        if (literalLength > input.size() - pos || literalLength > uncompressedSize - outPos)
+        {
+            throw SilKit::ProtocolError{"LzDecompress: literals exceed the block"};
+        }
+        if (literalLength != 0)
+        {
+            memcpy(output.data() + outPos, input.data() + pos, literalLength);
+        }
+        pos += literalLength;
+        outPos += literalLength;
+
+        if (pos == input.size())
+        {
+            break;
+        }
+
+        if (input.size() - pos < 2)
+        {
+            throw SilKit::ProtocolError{"LzDecompress: truncated offset"};
+        }
+        const size_t offset = static_cast<size_t>(input[pos]) | (static_cast<size_t>(input[pos + 1]) << 8);
+        pos += 2;
+        if (offset == 0 || offset > outPos)
+        {
+            throw SilKit::ProtocolError{"LzDecompress: invalid match offset"};
+        }
+
+        size_t matchLength = token & LengthMask;
+        if (matchLength == LengthMask)
+        {
+            matchLength += ReadLengthContinuation(input, pos);
+        }
+        matchLength += MinMatch;
+        if (matchLength > uncompressedSize - outPos)
+        {
+            throw SilKit::ProtocolError{"LzDecompress: match exceeds the uncompressed size"};
+        }
+
+        // the match may overlap the bytes it produces, which repeats the last offset bytes
+        const size_t matchPos = outPos - offset;
+        if (offset >= matchLength)
+        {
+            memcpy(output.data() + outPos, output.data() + matchPos, matchLength);
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                output[outPos + i] = output[matchPos + i];
+            }
+        }
+        outPos += matchLength;
+    }
+
+    if (outPos != uncompressedSize)
+    {
+        throw SilKit::ProtocolError{"LzDecompress: block does not match the uncompressed size"};
+    }
+
+    return output;
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include <cstdint>
+
+#include "silkit/util/Span.hpp"
+
+namespace SilKit {
+namespace Util {
+
+//! Compress the input into an LZ4-style block of sequences (literals followed by a back-reference).
+//! The result does not contain the size of the input, it must be transported alongside the block.
+auto LzCompress(Span<const uint8_t> input) -> std::vector<uint8_t>;
+
+//! Decompress a block produced by LzCompress into exactly uncompressedSize bytes.
+//! Throws SilKit::ProtocolError if the block is malformed or does not match the uncompressed size.
+auto LzDecompress(Span<const uint8_t> input, size_t uncompressedSize) -> std::vector<uint8_t>;
+
+} // namespace Util
+} // namespace SilKit
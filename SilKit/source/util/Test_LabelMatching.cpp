@@ -221,4 +221,35 @@ TEST_F(Test_LabelMatching, match_multiple_labels)
     }
 }
 
+TEST_F(Test_LabelMatching, match_many_labels)
+{
+    // Larger label lists are matched on lists sorted by key, the result must not depend on the order of the labels
+    std::vector<MatchingLabel> labels1{};
+    std::vector<MatchingLabel> labels2{};
+    for (int i = 0; i < 20; ++i)
+    {
+        const auto index = std::to_string(i);
+        labels1.push_back(MatchingLabel{"Key" + index, "Val" + index, MatchingLabel::Kind::Optional});
+        labels2.insert(labels2.begin(), MatchingLabel{"Key" + index, "Val" + index, MatchingLabel::Kind::Mandatory});
+    }
+    EXPECT_EQ(MatchLabels(labels1, labels2), true);
+    EXPECT_EQ(MatchLabels(labels2, labels1), true);
+
+    // Same Key, different Val => No match
+    labels2.back().value = "Other";
+    EXPECT_EQ(MatchLabels(labels1, labels2), false);
+    EXPECT_EQ(MatchLabels(labels2, labels1), false);
+
+    // Mandatory key missing on the other side => No match
+    labels2.back().value = "Val0";
+    labels2.push_back(MatchingLabel{"KeyMissing", "Val", MatchingLabel::Kind::Mandatory});
+    EXPECT_EQ(MatchLabels(labels1, labels2), false);
+    EXPECT_EQ(MatchLabels(labels2, labels1), false);
+
+    // Optional key missing on the other side => Match
+    labels2.back().kind = MatchingLabel::Kind::Optional;
+    EXPECT_EQ(MatchLabels(labels1, labels2), true);
+    EXPECT_EQ(MatchLabels(labels2, labels1), true);
+}
+
 } // anonymous namespace
@@ -20,24 +20,25 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
-#include <future>
-#include <thread>
+#include <atomic>
 #include <functional>
 #include <chrono>
+#include <memory>
 
-#include "SetThreadName.hpp"
+#include "TimerService.hpp"
 
 namespace SilKit {
 namespace Util {
 
+//! Periodic timer, which executes its callback on a callback thread of the shared TimerService.
 class Timer
 {
 public:
     Timer() = default;
 
     Timer(Timer&& other) noexcept
-        : _isRunning{other._isRunning.load()}
-        , _m{std::move(other._m)}
+        : _timerService{std::move(other._timerService)}
+        , _timerId{other._timerId.exchange(TimerService::InvalidTimerId)}
     {
     }
 
@@ -45,8 +46,9 @@ public:
     {
         if (this != &other)
         {
-            _isRunning = other._isRunning.load();
-            _m = std::move(other._m);
+            Stop();
+            _timerService = std::move(other._timerService);
+            _timerId = other._timerId.exchange(TimerService::InvalidTimerId);
         }
 
         return *this;
@@ -55,79 +57,53 @@ public:
     ~Timer()
     {
         Stop();
-        if (_m.thread.joinable())
-        {
-            _m.thread.join();
-        }
     }
 
 public:
     void Stop()
     {
-        if (_isRunning)
+        const auto timerId = _timerId.exchange(TimerService::InvalidTimerId);
+        if (timerId != TimerService::InvalidTimerId)
         {
-            _isRunning = false;
-            _m.promise.set_value();
+            _timerService->Cancel(timerId);
         }
     }
 
     void WithPeriod(std::chrono::nanoseconds period,
-        std::function<void(std::chrono::nanoseconds)> callback)
+        std::function<void(std::chrono::nanoseconds)> callback,
+        TimerService::ErrorHandler errorHandler = {})
     {
-        _m.period = period;
-        if (_m.period <= std::chrono::nanoseconds{0})
+        if (period <= std::chrono::nanoseconds{0})
         {
             return;
         }
 
-        _m.callback = std::move(callback);
-        if (!_m.callback)
+        if (!callback)
         {
             return;
         }
 
         Stop();
-        if (_m.thread.joinable())
+
+        if (_timerService == nullptr)
         {
-            _m.thread.join();
+            _timerService = TimerService::Get();
         }
 
-        _isRunning = true;
-        _m.promise = std::promise<void>{};
-        _m.thread = std::thread{&Timer::ThreadMain, this, _m.promise.get_future()};
+        _timerId = _timerService->SchedulePeriodic(period, [callback = std::move(callback)] {
+            const auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
+            callback(now);
+        }, std::move(errorHandler));
     }
 
     bool IsActive() const
     {
-        return  _isRunning;
-    }
-
-private:
-    // Methods
-    void ThreadMain(std::future<void> future)
-    {
-        SilKit::Util::SetThreadName("SilKit-Timer");
-        while (_isRunning)
-        {
-            if (future.wait_for(_m.period) == std::future_status::timeout)
-            {
-                const auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-                _m.callback(now);
-            }
-        }
+        return _timerId != TimerService::InvalidTimerId;
     }
 
 private:
-    // Immovable Members
-    std::atomic<bool> _isRunning{false};
-    // Movable Members
-    struct
-    {
-        std::chrono::nanoseconds period{0};
-        std::thread thread;
-        std::function<void(std::chrono::nanoseconds)> callback;
-        std::promise<void> promise;
-    } _m;
+    std::shared_ptr<TimerService> _timerService;
+    std::atomic<TimerService::TimerId> _timerId{TimerService::InvalidTimerId};
 };
 
 } // namespace Util
@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "TimerService.hpp"
+
+#include "SetThreadName.hpp"
+
+#include <algorithm>
+
+
+namespace SilKit {
+namespace Util {
+
+constexpr TimerService::TimerId TimerService::InvalidTimerId;
+
+namespace {
+
+//! The service whose callback is executed by the current thread, if any
+thread_local const TimerService* currentTimerService{nullptr};
+
+} // namespace
+
+auto TimerService::Get() -> std::shared_ptr<TimerService>
+{
+    static std::mutex mutex;
+    static std::weak_ptr<TimerService> instance;
+
+    std::lock_guard<decltype(mutex)> lock{mutex};
+
+    auto timerService = instance.lock();
+    if (timerService == nullptr)
+    {
+        // A callback which releases the last reference (e.g., by destroying its Util::Timer) cannot destroy the
+        // service itself, since the destructor joins the thread executing the callback.
+        auto deleter = [](TimerService* service) {
+            if (currentTimerService == service)
+            {
+                std::thread{[service] { delete service; }}.detach();
+            }
+            else
+            {
+                delete service;
+            }
+        };
+
+        timerService = std::shared_ptr<TimerService>{new TimerService{}, deleter};
+        instance = timerService;
+    }
+    return timerService;
+}
+
+TimerService::TimerService()
+{
+    _thread = std::thread{&TimerService::ThreadMain, this};
+}
+
+TimerService::~TimerService()
+{
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _stopping = true;
+    }
+    _wakeUp.notify_one();
+    _callbackDue.notify_all();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+
+    // the callback threads are only started by the service thread, which has finished
+    for (auto& callbackThread : _callbackThreads)
+    {
+        callbackThread.join();
+    }
+}
+
+auto TimerService::SchedulePeriodic(std::chrono::nanoseconds period, Callback callback, ErrorHandler errorHandler)
+    -> TimerId
+{
+    return Schedule(period, period, std::move(callback), std::move(errorHandler));
+}
+
+auto TimerService::ScheduleOnce(std::chrono::nanoseconds delay, Callback callback, ErrorHandler errorHandler)
+    -> TimerId
+{
+    return Schedule(delay, std::chrono::nanoseconds{0}, std::move(callback), std::move(errorHandler));
+}
+
+auto TimerService::Schedule(std::chrono::nanoseconds delay, std::chrono::nanoseconds period, Callback callback,
+                            ErrorHandler errorHandler) -> TimerId
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    const auto timerId = _nextTimerId++;
+    const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(delay);
+
+    _entries.emplace(timerId, Entry{period, deadline, std::make_shared<Callback>(std::move(callback)),
+                                    std::make_shared<ErrorHandler>(std::move(errorHandler))});
+    const auto position = _deadlines.emplace(deadline, timerId).first;
+    const auto isEarliest = position == _deadlines.begin();
+
+    lock.unlock();
+
+    if (isEarliest)
+    {
+        _wakeUp.notify_one();
+    }
+
+    return timerId;
+}
+
+void TimerService::Cancel(TimerId timerId)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto it = _entries.find(timerId);
+    if (it != _entries.end())
+    {
+        _deadlines.erase(std::make_pair(it->second.deadline, timerId));
+        _entries.erase(it);
+    }
+
+    auto running = _runningTimers.find(timerId);
+    if (running != _runningTimers.end() && running->second == std::this_thread::get_id())
+    {
+        return;
+    }
+
+    // a due callback which still waits for a free callback thread is dropped instead of waiting for it
+    if (running != _runningTimers.end() && running->second == std::thread::id{})
+    {
+        _dueTimers.erase(std::remove(_dueTimers.begin(), _dueTimers.end(), timerId), _dueTimers.end());
+        _runningTimers.erase(running);
+        return;
+    }
+
+    _callbackDone.wait(lock, [this, timerId] {
+        return _runningTimers.find(timerId) == _runningTimers.end();
+    });
+}
+
+void TimerService::ThreadMain()
+{
+    SetThreadName("SilKit-Timer");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    while (!_stopping)
+    {
+        if (_deadlines.empty())
+        {
+            _wakeUp.wait(lock);
+            continue;
+        }
+
+        const auto next = *_deadlines.begin();
+        if (Clock::now() < next.first)
+        {
+            _wakeUp.wait_until(lock, next.first);
+            continue;
+        }
+
+        _deadlines.erase(_deadlines.begin());
+
+        auto& entry = _entries.at(next.second);
+        if (entry.period != std::chrono::nanoseconds{0})
+        {
+            const auto now = Clock::now();
+            entry.deadline += std::chrono::duration_cast<Clock::duration>(entry.period);
+            if (entry.deadline < now)
+            {
+                // do not try to catch up on missed periods
+                entry.deadline = now + std::chrono::duration_cast<Clock::duration>(entry.period);
+            }
+            _deadlines.emplace(entry.deadline, next.second);
+        }
+
+        // a callback which is still running skips this deadline
+        if (!_runningTimers.emplace(next.second, std::thread::id{}).second)
+        {
+            continue;
+        }
+
+        _dueTimers.push_back(next.second);
+        if (_idleCallbackThreads < _dueTimers.size())
+        {
+            _callbackThreads.emplace_back(&TimerService::CallbackThreadMain, this);
+        }
+        _callbackDue.notify_one();
+    }
+}
+
+void TimerService::CallbackThreadMain()
+{
+    SetThreadName("SilKit-TimerCb");
+
+    currentTimerService = this;
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    while (true)
+    {
+        ++_idleCallbackThreads;
+        _callbackDue.wait(lock, [this] {
+            return _stopping || !_dueTimers.empty();
+        });
+        --_idleCallbackThreads;
+
+        if (_stopping)
+        {
+            return;
+        }
+
+        const auto timerId = _dueTimers.front();
+        _dueTimers.pop_front();
+
+        // the timer may have been cancelled after it was handed to this thread
+        auto it = _entries.find(timerId);
+        if (it != _entries.end())
+        {
+            const auto entry = it->second;
+            _runningTimers[timerId] = std::this_thread::get_id();
+
+            if (entry.period == std::chrono::nanoseconds{0})
+            {
+                _entries.erase(it);
+            }
+
+            lock.unlock();
+            ExecuteCallback(entry);
+            lock.lock();
+        }
+
+        _runningTimers.erase(timerId);
+        _callbackDone.notify_all();
+    }
+}
+
+void TimerService::ExecuteCallback(const Entry& entry)
+{
+    std::string message;
+
+    try
+    {
+        (*entry.callback)();
+        return;
+    }
+    catch (const std::exception& exception)
+    {
+        message = std::string{"TimerService: callback threw an exception: "} + exception.what();
+    }
+    catch (...)
+    {
+        message = "TimerService: callback threw an unknown exception";
+    }
+
+    try
+    {
+        if (*entry.errorHandler)
+        {
+            (*entry.errorHandler)(message);
+        }
+    }
+    catch (...)
+    {
+    }
+}
+
+} // namespace Util
+} // namespace SilKit
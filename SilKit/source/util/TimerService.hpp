@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+/*! \brief Process-wide thread which executes periodic and one-shot callbacks at their deadlines.
+ *
+ * All users (e.g., Util::Timer and the WatchDog of the time synchronization) share a single thread, which sleeps
+ * until the earliest deadline, or indefinitely if no callback is scheduled. The thread exists only as long as at
+ * least one user holds a reference to the service.
+ *
+ * Due callbacks are handed to callback threads, which are started on demand whenever all existing ones are busy, so a
+ * slow or blocking callback never delays the others. The threads are reused, their number only grows to the number of
+ * callbacks which were running at the same time. The number of threads is deliberately not limited: With a limit, a
+ * few blocking user callbacks would starve all other timers of the process, including the watchdogs which are
+ * supposed to report such a hang. A callback is never executed concurrently with itself, deadlines which pass while it
+ * is still running are skipped. Exceptions thrown by a callback are caught and reported to the error handler of the
+ * timer.
+ *
+ * A callback may release the last reference to the shared instance returned by Get() (e.g., by destroying the
+ * Util::Timer it belongs to), the service is then destroyed on a separate thread. Instances which are constructed
+ * directly must not be destroyed from within one of their callbacks.
+ */
+class TimerService
+{
+public:
+    using TimerId = uint64_t;
+    using Callback = std::function<void()>;
+    using ErrorHandler = std::function<void(const std::string& message)>;
+
+    static constexpr TimerId InvalidTimerId{0};
+
+public:
+    //! Returns the shared instance, which is created if it does not exist yet.
+    static auto Get() -> std::shared_ptr<TimerService>;
+
+    TimerService();
+    ~TimerService();
+
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+
+public:
+    /*! \brief Executes the callback every period, starting one period from now.
+     *
+     * If the callback throws, the error handler is called with a description of the exception, which is usually
+     * forwarded to the logger of the participant. The timer stays scheduled.
+     */
+    auto SchedulePeriodic(std::chrono::nanoseconds period, Callback callback, ErrorHandler errorHandler = {})
+        -> TimerId;
+
+    /*! \brief Executes the callback once, after the delay has passed.
+     *
+     * The timer is removed before the callback is executed, so the callback may schedule a new one. Errors are
+     * handled as for periodic callbacks.
+     */
+    auto ScheduleOnce(std::chrono::nanoseconds delay, Callback callback, ErrorHandler errorHandler = {}) -> TimerId;
+
+    /*! \brief Removes the callback. It is not executed after this function returns.
+     *
+     * If called from a different thread while the callback is executed, this function waits until it is done. If
+     * called from within the callback, the function returns immediately. A due callback which has not been picked up
+     * by a callback thread yet is dropped.
+     */
+    void Cancel(TimerId timerId);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        //! Zero for callbacks which are executed only once
+        std::chrono::nanoseconds period;
+        Clock::time_point deadline;
+        std::shared_ptr<Callback> callback;
+        std::shared_ptr<ErrorHandler> errorHandler;
+    };
+
+    auto Schedule(std::chrono::nanoseconds delay, std::chrono::nanoseconds period, Callback callback,
+                  ErrorHandler errorHandler) -> TimerId;
+
+    void ThreadMain();
+    void CallbackThreadMain();
+    void ExecuteCallback(const Entry& entry);
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _wakeUp;
+    std::condition_variable _callbackDue;
+    std::condition_variable _callbackDone;
+    bool _stopping{false};
+
+    TimerId _nextTimerId{1};
+    std::map<TimerId, Entry> _entries;
+    std::set<std::pair<Clock::time_point, TimerId>> _deadlines;
+
+    //! Timers which are handed to a callback thread, with the thread executing them (if already started)
+    std::map<TimerId, std::thread::id> _runningTimers;
+    std::deque<TimerId> _dueTimers;
+    size_t _idleCallbackThreads{0};
+
+    std::thread _thread;
+    std::vector<std::thread> _callbackThreads;
+};
+
+} // namespace Util
+} // namespace SilKit
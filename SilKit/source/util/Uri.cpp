@@ -45,7 +45,7 @@ auto Uri::Port() const -> uint16_t
         return *_port;
     }
     //return default value if not set
-    if(Type() == UriType::Local)
+    if(Type() == UriType::Local || Type() == UriType::SharedMemory)
     {
         return 0;
     }
@@ -118,8 +118,13 @@ auto Uri::Parse(std::string rawUri) -> Uri
     {
         uri.SetType(UriType::Local);
     }
+    else if(uri.Scheme() == "shm")
+    {
+        // the path of the local-domain socket used to set up the shared memory stream
+        uri.SetType(UriType::SharedMemory);
+    }
    
-    if(uri.Type() == UriType::Local)
+    if(uri.Type() == UriType::Local || uri.Type() == UriType::SharedMemory)
     {
         //must be a path, might contain ':' (currently not quoted)
         uri._path = rawUri;
@@ -39,7 +39,8 @@ public:
     {
         Undefined,
         Tcp,
-        Local
+        Local,
+        SharedMemory
     };
 
 public:
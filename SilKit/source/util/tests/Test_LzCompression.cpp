@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "LzCompression.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include "silkit/participant/exception.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Util::LzCompress;
+using SilKit::Util::LzDecompress;
+
+auto RoundTrip(const std::vector<uint8_t>& input) -> std::vector<uint8_t>
+{
+    const auto compressed = LzCompress(input);
+    return LzDecompress(compressed, input.size());
+}
+
+TEST(Test_LzCompression, round_trip_of_short_inputs)
+{
+    for (size_t size = 0; size < 32; ++size)
+    {
+        std::vector<uint8_t> input(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            input[i] = static_cast<uint8_t>(i % 3);
+        }
+        EXPECT_EQ(RoundTrip(input), input) << "size " << size;
+    }
+}
+
+TEST(Test_LzCompression, repetitive_input_is_compressed)
+{
+    std::vector<uint8_t> input;
+    const std::string pattern{"The quick brown fox jumps over the lazy dog. "};
+    while (input.size() < 64 * 1024)
+    {
+        input.insert(input.end(), pattern.begin(), pattern.end());
+    }
+
+    const auto compressed = LzCompress(input);
+    EXPECT_LT(compressed.size(), input.size() / 10);
+    EXPECT_EQ(LzDecompress(compressed, input.size()), input);
+
+    // long runs of a single byte produce overlapping matches and long length continuations
+    const std::vector<uint8_t> zeros(100000, 0);
+    EXPECT_LT(LzCompress(zeros).size(), size_t{1024});
+    EXPECT_EQ(RoundTrip(zeros), zeros);
+}
+
+TEST(Test_LzCompression, random_input_round_trips)
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, 255};
+
+    std::vector<uint8_t> input(200000);
+    for (auto& byte : input)
+    {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    // insert a repetition which lies further back than the maximum offset
+    std::copy(input.begin(), input.begin() + 1000, input.begin() + 100000);
+
+    EXPECT_EQ(RoundTrip(input), input);
+}
+
+TEST(Test_LzCompression, malformed_input_throws)
+{
+    std::vector<uint8_t> input(1000, 'a');
+    const auto compressed = LzCompress(input);
+
+    EXPECT_THROW(LzDecompress(compressed, input.size() - 1), SilKit::ProtocolError);
+    EXPECT_THROW(LzDecompress(compressed, input.size() + 1), SilKit::ProtocolError);
+
+    const std::vector<uint8_t> truncated{compressed.begin(), compressed.begin() + 3};
+    EXPECT_THROW(LzDecompress(truncated, input.size()), SilKit::ProtocolError);
+
+    // a match which refers to data before the start of the output
+    const std::vector<uint8_t> invalidOffset{0x10, 'a', 0x05, 0x00};
+    EXPECT_THROW(LzDecompress(invalidOffset, 10), SilKit::ProtocolError);
+}
+
+TEST(Test_LzCompression, uncompressed_size_beyond_the_maximum_expansion_throws)
+{
+    // the size is rejected before the output is allocated
+    const std::vector<uint8_t> block{0x10, 'a'};
+    EXPECT_THROW(LzDecompress(block, size_t{1} << 40), SilKit::ProtocolError);
+    EXPECT_THROW(LzDecompress(block, 3 * 255), SilKit::ProtocolError);
+
+    // the largest expansion, every continuation byte of a match length produces 255 bytes
+    const std::vector<uint8_t> zeros(100000, 0);
+    const auto compressed = LzCompress(zeros);
+    EXPECT_LE(zeros.size(), compressed.size() * 255);
+    EXPECT_EQ(LzDecompress(compressed, zeros.size()), zeros);
+}
+
+} // namespace
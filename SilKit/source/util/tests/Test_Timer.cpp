@@ -21,6 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "Timer.hpp"
 
+#include <future>
+#include <memory>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
@@ -57,4 +60,54 @@ TEST(Test_Timer, ensure_util_timer_works)
     }
 }
 
+TEST(Test_Timer, timer_can_be_destroyed_from_within_its_callback)
+{
+    std::promise<void> done;
+    auto isDone = done.get_future();
+
+    // the timer holds the only reference to the shared timer service, which must not be destroyed on its own thread
+    auto timer = std::make_unique<SilKit::Util::Timer>();
+    timer->WithPeriod(std::chrono::milliseconds(10), [&](const auto) {
+        if (timer != nullptr)
+        {
+            timer.reset();
+            done.set_value();
+        }
+    });
+
+    ASSERT_EQ(isDone.wait_for(5s), std::future_status::ready);
+
+    // a new service is created for the next timer
+    std::promise<void> next;
+    auto isNext = next.get_future();
+    SilKit::Util::Timer nextTimer;
+    nextTimer.WithPeriod(std::chrono::milliseconds(10), [&, numCalls = 0](const auto) mutable {
+        if (++numCalls == 1)
+        {
+            next.set_value();
+        }
+    });
+    ASSERT_EQ(isNext.wait_for(5s), std::future_status::ready);
+}
+
+TEST(Test_Timer, timer_can_be_destroyed_from_within_its_callback_while_the_service_is_shared)
+{
+    const auto timerService = SilKit::Util::TimerService::Get();
+
+    std::promise<void> done;
+    auto isDone = done.get_future();
+
+    auto timer = std::make_unique<SilKit::Util::Timer>();
+    timer->WithPeriod(std::chrono::milliseconds(10), [&](const auto) {
+        if (timer != nullptr)
+        {
+            timer.reset();
+            done.set_value();
+        }
+    });
+
+    ASSERT_EQ(isDone.wait_for(5s), std::future_status::ready);
+    EXPECT_FALSE(timer);
+}
+
 }
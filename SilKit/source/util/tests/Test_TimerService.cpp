@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: 2023 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "TimerService.hpp"
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using SilKit::Util::TimerService;
+
+TEST(Test_TimerService, callbacks_are_executed_in_the_order_of_their_deadlines)
+{
+    TimerService timerService;
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+
+    auto record = [&](int id) {
+        std::lock_guard<decltype(mutex)> lock{mutex};
+        if (order.size() < 3)
+        {
+            order.push_back(id);
+            if (order.size() == 3)
+            {
+                done.set_value();
+            }
+        }
+    };
+
+    const auto third = timerService.SchedulePeriodic(150ms, [&] { record(3); });
+    const auto first = timerService.SchedulePeriodic(50ms, [&] { record(1); });
+    const auto second = timerService.SchedulePeriodic(100ms, [&] { record(2); });
+
+    ASSERT_EQ(done.get_future().wait_for(5s), std::future_status::ready);
+
+    timerService.Cancel(first);
+    timerService.Cancel(second);
+    timerService.Cancel(third);
+
+    // the first timer is due again at 100ms, together with the second one, both before the third one
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_NE(order[2], 3);
+}
+
+TEST(Test_TimerService, cancelled_callback_is_not_executed)
+{
+    TimerService timerService;
+
+    std::atomic<int> numCalls{0};
+    const auto timerId = timerService.SchedulePeriodic(20ms, [&] { ++numCalls; });
+    timerService.Cancel(timerId);
+
+    std::this_thread::sleep_for(100ms);
+    EXPECT_EQ(numCalls, 0);
+
+    // cancelling an unknown or already cancelled timer does nothing
+    timerService.Cancel(timerId);
+    timerService.Cancel(TimerService::InvalidTimerId);
+}
+
+TEST(Test_TimerService, cancel_waits_for_the_running_callback)
+{
+    TimerService timerService;
+
+    std::promise<void> started;
+    std::atomic<bool> finished{false};
+
+    const auto timerId = timerService.SchedulePeriodic(10ms, [&] {
+        if (!finished)
+        {
+            started.set_value();
+            std::this_thread::sleep_for(100ms);
+            finished = true;
+        }
+    });
+
+    ASSERT_EQ(started.get_future().wait_for(5s), std::future_status::ready);
+    timerService.Cancel(timerId);
+    EXPECT_TRUE(finished);
+}
+
+TEST(Test_TimerService, callback_can_cancel_and_schedule_timers)
+{
+    TimerService timerService;
+
+    std::promise<void> rearmedCalled;
+    std::atomic<bool> rearmedDone{false};
+    std::atomic<int> numCalls{0};
+    std::atomic<TimerService::TimerId> timerId{TimerService::InvalidTimerId};
+
+    std::promise<void> scheduled;
+    auto isScheduled = scheduled.get_future().share();
+
+    timerId = timerService.SchedulePeriodic(10ms, [&] {
+        isScheduled.wait();
+        ++numCalls;
+
+        // cancel itself and re-arm with a new timer, from within the callback
+        timerService.Cancel(timerId);
+        timerId = timerService.SchedulePeriodic(10ms, [&] {
+            if (!rearmedDone.exchange(true))
+            {
+                rearmedCalled.set_value();
+            }
+        });
+    });
+    scheduled.set_value();
+
+    ASSERT_EQ(rearmedCalled.get_future().wait_for(5s), std::future_status::ready);
+    timerService.Cancel(timerId);
+    EXPECT_EQ(numCalls, 1);
+}
+
+TEST(Test_TimerService, throwing_callback_is_reported_and_stays_scheduled)
+{
+    TimerService timerService;
+
+    std::mutex mutex;
+    std::vector<std::string> errors;
+    std::promise<void> done;
+
+    std::atomic<int> numCalls{0};
+    const auto timerId = timerService.SchedulePeriodic(
+        10ms,
+        [&] {
+            if (++numCalls <= 2)
+            {
+                throw std::runtime_error{"callback failed"};
+            }
+            if (numCalls == 3)
+            {
+                done.set_value();
+            }
+        },
+        [&](const std::string& message) {
+            std::lock_guard<decltype(mutex)> lock{mutex};
+            errors.push_back(message);
+        });
+
+    ASSERT_EQ(done.get_future().wait_for(5s), std::future_status::ready);
+    timerService.Cancel(timerId);
+
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_NE(errors[0].find("callback failed"), std::string::npos);
+}
+
+TEST(Test_TimerService, slow_callback_does_not_delay_other_timers)
+{
+    TimerService timerService;
+
+    std::promise<void> release;
+    auto isReleased = release.get_future().share();
+    std::atomic<bool> blocked{false};
+
+    const auto slowTimerId = timerService.SchedulePeriodic(10ms, [&] {
+        blocked = true;
+        isReleased.wait();
+    });
+
+    std::atomic<int> numFastCalls{0};
+    std::promise<void> fastDone;
+    const auto fastTimerId = timerService.SchedulePeriodic(10ms, [&] {
+        if (blocked && ++numFastCalls == 5)
+        {
+            fastDone.set_value();
+        }
+    });
+
+    const auto status = fastDone.get_future().wait_for(5s);
+    release.set_value();
+
+    timerService.Cancel(slowTimerId);
+    timerService.Cancel(fastTimerId);
+
+    EXPECT_EQ(status, std::future_status::ready);
+}
+
+TEST(Test_TimerService, one_shot_callback_is_executed_once)
+{
+    TimerService timerService;
+
+    std::atomic<int> numCalls{0};
+    std::promise<void> done;
+    timerService.ScheduleOnce(10ms, [&] {
+        if (++numCalls == 1)
+        {
+            done.set_value();
+        }
+    });
+
+    ASSERT_EQ(done.get_future().wait_for(5s), std::future_status::ready);
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(numCalls, 1);
+}
+
+TEST(Test_TimerService, callback_scheduled_while_idle_wakes_the_service)
+{
+    TimerService timerService;
+
+    std::promise<void> firstDone;
+    timerService.ScheduleOnce(10ms, [&] { firstDone.set_value(); });
+    ASSERT_EQ(firstDone.get_future().wait_for(5s), std::future_status::ready);
+
+    // the service now waits without any deadline and must be woken by the new one
+    std::this_thread::sleep_for(20ms);
+
+    std::promise<void> secondDone;
+    timerService.ScheduleOnce(10ms, [&] { secondDone.set_value(); });
+    EXPECT_EQ(secondDone.get_future().wait_for(5s), std::future_status::ready);
+}
+
+TEST(Test_TimerService, cancelled_one_shot_callback_is_not_executed)
+{
+    TimerService timerService;
+
+    std::atomic<int> numCalls{0};
+    const auto timerId = timerService.ScheduleOnce(20ms, [&] { ++numCalls; });
+    timerService.Cancel(timerId);
+
+    // cancelling an executed one-shot timer has no effect
+    std::promise<void> done;
+    const auto executedTimerId = timerService.ScheduleOnce(0ms, [&] { done.set_value(); });
+    ASSERT_EQ(done.get_future().wait_for(5s), std::future_status::ready);
+    timerService.Cancel(executedTimerId);
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(numCalls, 0);
+}
+
+TEST(Test_TimerService, blocking_callbacks_do_not_starve_other_timers)
+{
+    TimerService timerService;
+
+    std::promise<void> release;
+    auto isReleased = release.get_future().share();
+    std::atomic<size_t> numBlocked{0};
+
+    // more blocking callbacks than a reasonably sized thread pool would have
+    constexpr size_t numBlockingTimers{16};
+    std::vector<TimerService::TimerId> blockingTimerIds;
+    for (size_t i = 0; i < numBlockingTimers; ++i)
+    {
+        blockingTimerIds.push_back(timerService.SchedulePeriodic(10ms, [&] {
+            ++numBlocked;
+            isReleased.wait();
+        }));
+    }
+
+    std::atomic<int> numCalls{0};
+    std::promise<void> done;
+    const auto timerId = timerService.SchedulePeriodic(10ms, [&] {
+        if (numBlocked == numBlockingTimers && ++numCalls == 5)
+        {
+            done.set_value();
+        }
+    });
+
+    const auto status = done.get_future().wait_for(5s);
+    release.set_value();
+
+    timerService.Cancel(timerId);
+    for (const auto blockingTimerId : blockingTimerIds)
+    {
+        timerService.Cancel(blockingTimerId);
+    }
+
+    EXPECT_EQ(numBlocked, numBlockingTimers);
+    EXPECT_EQ(status, std::future_status::ready);
+}
+
+} // namespace
@@ -27,6 +27,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SharedVector.hpp"
 
 #include <chrono>
+#include <cstdlib>
+#include <string>
 #include <vector>
 
 namespace SilKit {
@@ -97,6 +99,29 @@ struct CanSetControllerMode
     CanControllerState mode; //!< State that the CAN controller should reach.
 };
 
+/*! \brief Acceptance filter of a CAN controller, announced in the service discovery
+ *
+ * A frame passes the filter if the bits of its CAN identifier selected by the mask equal those of the filter, and
+ * the frame flags selected by the flags mask equal those of the filter. The latter distinguishes, e.g., standard and
+ * extended frames (CanFrameFlag::Ide) with the same numeric identifier.
+ */
+struct CanAcceptanceFilter
+{
+    uint32_t canId; //!< CAN identifier the frames are compared with
+    uint32_t mask; //!< Bits of the CAN identifier which are compared
+    CanFrameFlagMask flags; //!< Frame flags the frames are compared with
+    CanFrameFlagMask flagsMask; //!< Frame flags which are compared
+};
+
+//! \brief True if the list of filters is empty or any filter lets a frame with the CAN identifier and flags pass
+inline bool AcceptsCanId(const std::vector<CanAcceptanceFilter>& filters, uint32_t canId, CanFrameFlagMask flags);
+
+//! \brief Format the filters as announced in the service discovery, i.e., hexadecimal "canId/mask/flags/flagsMask"
+//!        separated by ','
+inline auto FormatCanAcceptanceFilters(const std::vector<CanAcceptanceFilter>& filters) -> std::string;
+//! \brief Parse the filters announced in the service discovery, the result is empty if the string is malformed
+inline auto ParseCanAcceptanceFilters(const std::string& string) -> std::vector<CanAcceptanceFilter>;
+
 inline std::string to_string(const WireCanFrame& msg);
 inline std::string to_string(const CanControllerStatus& status);
 inline std::string to_string(const CanConfigureBaudrate& rate);
@@ -134,6 +159,82 @@ auto MakeWireCanFrameEvent(const CanFrameEvent& canFrameEvent) -> WireCanFrameEv
             canFrameEvent.userContext};
 }
 
+bool AcceptsCanId(const std::vector<CanAcceptanceFilter>& filters, uint32_t canId, CanFrameFlagMask flags)
+{
+    if (filters.empty())
+    {
+        return true;
+    }
+
+    for (const auto& filter : filters)
+    {
+        if ((canId & filter.mask) == (filter.canId & filter.mask)
+            && (flags & filter.flagsMask) == (filter.flags & filter.flagsMask))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+auto FormatCanAcceptanceFilters(const std::vector<CanAcceptanceFilter>& filters) -> std::string
+{
+    std::stringstream outStream;
+    outStream << std::hex;
+    for (size_t index = 0; index != filters.size(); ++index)
+    {
+        if (index != 0)
+        {
+            outStream << ',';
+        }
+        outStream << filters[index].canId << '/' << filters[index].mask << '/' << filters[index].flags << '/'
+                  << filters[index].flagsMask;
+    }
+    return outStream.str();
+}
+
+auto ParseCanAcceptanceFilters(const std::string& string) -> std::vector<CanAcceptanceFilter>
+{
+    std::vector<CanAcceptanceFilter> filters;
+
+    const char* current = string.c_str();
+    while (*current != '\0')
+    {
+        char* end = nullptr;
+
+        CanAcceptanceFilter filter{};
+        uint32_t* const fields[] = {&filter.canId, &filter.mask, &filter.flags, &filter.flagsMask};
+        for (size_t index = 0; index != 4; ++index)
+        {
+            if (index != 0)
+            {
+                if (*end != '/')
+                {
+                    return {};
+                }
+                current = end + 1;
+            }
+
+            *fields[index] = static_cast<uint32_t>(std::strtoul(current, &end, 16));
+            if (end == current)
+            {
+                return {};
+            }
+        }
+
+        if (*end != ',' && *end != '\0')
+        {
+            return {};
+        }
+
+        filters.push_back(filter);
+        current = (*end == ',') ? end + 1 : end;
+    }
+
+    return filters;
+}
+
 std::string to_string(const WireCanFrame& msg)
 {
     return to_string(ToCanFrame(msg));
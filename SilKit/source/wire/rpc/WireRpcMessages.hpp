@@ -43,7 +43,7 @@ struct FunctionCall
 {
     std::chrono::nanoseconds timestamp;
     Util::Uuid callUuid;
-    std::vector<uint8_t> data;
+    Util::SharedVector<uint8_t> data;
 };
 
 /*! \brief Rpc response with function return data
@@ -60,7 +60,7 @@ struct FunctionCallResponse
 
     std::chrono::nanoseconds timestamp;
     Util::Uuid callUuid;
-    std::vector<uint8_t> data;
+    Util::SharedVector<uint8_t> data;
     Status status;
 };
 
@@ -82,12 +82,12 @@ inline std::ostream& operator<<(std::ostream& out, const FunctionCallResponse& m
 
 bool operator==(const FunctionCall& lhs, const FunctionCall& rhs)
 {
-    return lhs.callUuid == rhs.callUuid && lhs.data == rhs.data;
+    return lhs.callUuid == rhs.callUuid && Util::ItemsAreEqual(lhs.data, rhs.data);
 }
 
 bool operator==(const FunctionCallResponse& lhs, const FunctionCallResponse& rhs)
 {
-    return lhs.callUuid == rhs.callUuid && lhs.data == rhs.data && lhs.status == rhs.status;
+    return lhs.callUuid == rhs.callUuid && Util::ItemsAreEqual(lhs.data, rhs.data) && lhs.status == rhs.status;
 }
 
 std::string to_string(const FunctionCall& msg)
@@ -100,8 +100,8 @@ std::string to_string(const FunctionCall& msg)
 std::ostream& operator<<(std::ostream& out, const FunctionCall& msg)
 {
     return out << "rpc::FunctionCall{callUUID=" << msg.callUuid
-               << ", data=" << Util::AsHexString(msg.data).WithSeparator(" ").WithMaxLength(16)
-               << ", size=" << msg.data.size() << "}";
+               << ", data=" << Util::AsHexString(msg.data.AsSpan()).WithSeparator(" ").WithMaxLength(16)
+               << ", size=" << msg.data.AsSpan().size() << "}";
 }
 
 std::string to_string(const FunctionCallResponse::Status& status)
@@ -133,8 +133,8 @@ std::string to_string(const FunctionCallResponse& msg)
 std::ostream& operator<<(std::ostream& out, const FunctionCallResponse& msg)
 {
     return out << "rpc::FunctionCallResponse{callUUID=" << msg.callUuid
-               << ", data=" << Util::AsHexString(msg.data).WithSeparator(" ").WithMaxLength(16)
-               << ", size=" << msg.data.size()
+               << ", data=" << Util::AsHexString(msg.data.AsSpan()).WithSeparator(" ").WithMaxLength(16)
+               << ", size=" << msg.data.AsSpan().size()
                << ", status=" << msg.status << "}";
 }
 
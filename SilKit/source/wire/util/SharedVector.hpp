@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -45,10 +46,14 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Refer to the items of the span without copying them. The owner keeps the items alive.
+    SharedVector(std::shared_ptr<const void> owner, Span<const T> span);
+
     auto AsSpan() const& -> Span<const T>;
 
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    std::shared_ptr<const T> _data;
+    size_t _size{0};
 };
 
 template <typename T>
@@ -66,28 +71,33 @@ SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
 
 template <typename T>
 SharedVector<T>::SharedVector(std::vector<T> vector)
-    : _data{std::make_shared<std::vector<T>>(std::move(vector))}
 {
+    auto owner = std::make_shared<const std::vector<T>>(std::move(vector));
+    _data = std::shared_ptr<const T>{owner, owner->data()};
+    _size = owner->size();
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
+    : SharedVector([span, minimumSize, padValue] {
+        std::vector<T> vector(span.begin(), span.end());
+        vector.resize((std::max)(vector.size(), minimumSize), padValue);
+        return vector;
+    }())
+{
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<const void> owner, Span<const T> span)
+    : _data{std::move(owner), span.data()}
+    , _size{span.size()}
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
 }
 
 template <typename T>
 auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {
-    if (_data)
-    {
-        return {_data->data(), _data->size()};
-    }
-    else
-    {
-        return {nullptr, 0};
-    }
+    return {_data.get(), _size};
 }
 
 template <typename T>